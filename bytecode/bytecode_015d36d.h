@@ -14,24 +14,11 @@ class GDScriptDecomp_015d36d : public GDScriptDecomp {
 protected:
 	static void _bind_methods(){};
 
-	static const int bytecode_version = 12;
-
-	enum {
-		TOKEN_BYTE_MASK = 0x80,
-		TOKEN_BITS = 8,
-		TOKEN_MASK = (1 << TOKEN_BITS) - 1,
-		TOKEN_LINE_BITS = 24,
-		TOKEN_LINE_MASK = (1 << TOKEN_LINE_BITS) - 1,
-	};
+	static const char *func_names[];
+	static const GlobalToken revision_tokens[];
 
 public:
-	virtual Error decompile_buffer(Vector<uint8_t> p_buffer) override;
-	virtual BYTECODE_TEST_RESULT test_bytecode(Vector<uint8_t> buffer) override { return BYTECODE_TEST_RESULT::BYTECODE_TEST_UNKNOWN; }; // not implemented
-	GDScriptDecomp_015d36d() {
-		bytecode_rev = 0x015d36d;
-		engine_ver_major = 3;
-		variant_ver_major = 3;
-	}
+	GDScriptDecomp_015d36d();
 };
 
 #endif
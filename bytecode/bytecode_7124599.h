@@ -14,24 +14,12 @@ class GDScriptDecomp_7124599 : public GDScriptDecomp {
 protected:
 	static void _bind_methods(){};
 
-	static const int bytecode_version = 10;
-
-	enum {
-		TOKEN_BYTE_MASK = 0x80,
-		TOKEN_BITS = 8,
-		TOKEN_MASK = (1 << TOKEN_BITS) - 1,
-		TOKEN_LINE_BITS = 24,
-		TOKEN_LINE_MASK = (1 << TOKEN_LINE_BITS) - 1,
-	};
+	static const char *func_names[];
+	static const GlobalToken revision_tokens[];
 
 public:
-	virtual Error decompile_buffer(Vector<uint8_t> p_buffer) override;
-	virtual BYTECODE_TEST_RESULT test_bytecode(Vector<uint8_t> buffer) override;
-	GDScriptDecomp_7124599() {
-		bytecode_rev = 0x7124599;
-		engine_ver_major = 2;
-		variant_ver_major = 2;
-	}
+	virtual BYTECODE_TEST_RESULT test_token_stream(const GDSCTokenStream &p_stream) const override;
+	GDScriptDecomp_7124599();
 };
 
 #endif
@@ -20,6 +20,8 @@ void GDScriptDecomp::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_script_text"), &GDScriptDecomp::get_script_text);
 	ClassDB::bind_method(D_METHOD("get_error_message"), &GDScriptDecomp::get_error_message);
+	ClassDB::bind_method(D_METHOD("get_function_arg_count", "func_id"), &GDScriptDecomp::get_function_arg_count);
+	ClassDB::bind_method(D_METHOD("get_function_arg_count_by_name", "func_name"), &GDScriptDecomp::get_function_arg_count_by_name);
 }
 
 void GDScriptDecomp::_ensure_space(String &p_code) {
@@ -134,7 +136,7 @@ HashMap<String, Pair<int, int>> _inithashmap() {
 
 static const HashMap<String, Pair<int, int>> builtin_func_arg_map = _inithashmap();
 
-Pair<int, int> GDScriptDecomp::get_arg_count_for_builtin(String builtin_func_name) {
+Pair<int, int> GDScriptDecomp::get_arg_count_for_builtin(const String &builtin_func_name) const {
 	if (!builtin_func_arg_map.has(builtin_func_name)) {
 		return Pair<int, int>(-1, -1);
 	}
@@ -159,6 +161,299 @@ Pair<int, int> GDScriptDecomp::get_arg_count_for_builtin(String builtin_func_nam
 	return builtin_func_arg_map[builtin_func_name];
 }
 
+void GDScriptDecomp::_set_revision_tables(const GlobalToken *p_tokens, int p_token_count, const char **p_func_names, int p_func_count) {
+	ERR_FAIL_COND(p_token_count > TOKEN_MASK + 1);
+	// ids past the end of the revision's token list are invalid and decompile to nothing
+	for (int i = 0; i <= TOKEN_MASK; i++) {
+		token_map[i] = i < p_token_count ? p_tokens[i] : G_TK_MAX;
+	}
+	builtin_func_names = p_func_names;
+	builtin_func_count = p_func_count;
+	// bytecode_rev is already set here; resolve the arg counts once instead of looking up the name for every call token
+	builtin_func_arg_counts.resize(p_func_count);
+	Pair<int, int> *arg_counts = builtin_func_arg_counts.ptrw();
+	for (int i = 0; i < p_func_count; i++) {
+		arg_counts[i] = get_arg_count_for_builtin(p_func_names[i]);
+	}
+}
+
+Vector2i GDScriptDecomp::get_function_arg_count(int p_func_id) const {
+	Pair<int, int> arg_count = get_builtin_func_arg_count(p_func_id);
+	return Vector2i(arg_count.first, arg_count.second);
+}
+
+Vector2i GDScriptDecomp::get_function_arg_count_by_name(const String &p_func_name) const {
+	Pair<int, int> arg_count = get_arg_count_for_builtin(p_func_name);
+	return Vector2i(arg_count.first, arg_count.second);
+}
+
+// we should be after the open parenthesis, which has already been checked
+bool GDScriptDecomp::test_built_in_func_arg_count(const Vector<uint32_t> &p_tokens, Pair<int, int> p_arg_count, int &r_pos) const {
+	int pos = r_pos;
+	int comma_count = 0;
+	int min_args = p_arg_count.first;
+	int max_args = p_arg_count.second;
+	GlobalToken t = G_TK_MAX;
+	int bracket_open = 0;
+
+	if (min_args == 0 && max_args == 0) {
+		for (; pos < p_tokens.size(); pos++) {
+			t = get_global_token(p_tokens[pos]);
+			if (t == G_TK_PARENTHESIS_CLOSE) {
+				break;
+			} else if (t != G_TK_NEWLINE) {
+				return false;
+			}
+		}
+		// if we didn't find a close parenthesis, then we have an error
+		if (pos == p_tokens.size()) {
+			return false;
+		}
+		r_pos = pos;
+		return true;
+	}
+	// count the commas
+	// at least in 3.x and below, the only time commas are allowed in function args are other expressions
+	// this is not the case for GDScript 2.0 (4.x), due to lambdas, but that doesn't have a compiled version yet
+	for (; pos < p_tokens.size(); pos++) {
+		t = get_global_token(p_tokens[pos]);
+		switch (t) {
+			case G_TK_BRACKET_OPEN:
+			case G_TK_CURLY_BRACKET_OPEN:
+			case G_TK_PARENTHESIS_OPEN:
+				bracket_open++;
+				break;
+			case G_TK_BRACKET_CLOSE:
+			case G_TK_CURLY_BRACKET_CLOSE:
+			case G_TK_PARENTHESIS_CLOSE:
+				bracket_open--;
+				break;
+			case G_TK_COMMA:
+				if (bracket_open == 0) {
+					comma_count++;
+				}
+				break;
+			default:
+				break;
+		}
+		if (bracket_open == -1) {
+			break;
+		}
+	}
+	// trailing commas are not allowed after the last argument
+	if (pos == p_tokens.size() || t != G_TK_PARENTHESIS_CLOSE || comma_count < min_args - 1 || comma_count > max_args - 1) {
+		return false;
+	}
+	r_pos = pos;
+	return true;
+}
+
+enum TokenSpacing {
+	TOKEN_SPACE_NONE,
+	TOKEN_SPACE_BEFORE,
+	TOKEN_SPACE_BEFORE_IF_NOT_LINE_START,
+};
+
+struct TokenText {
+	const char *text;
+	TokenSpacing spacing;
+};
+
+// Output for every global token, indexed by GDScriptDecomp::GlobalToken
+// nullptr entries are either handled in decompile_buffer() or emit nothing
+static const TokenText token_texts[] = {
+	{ nullptr, TOKEN_SPACE_NONE }, // G_TK_EMPTY
+	{ nullptr, TOKEN_SPACE_NONE }, // G_TK_IDENTIFIER
+	{ nullptr, TOKEN_SPACE_NONE }, // G_TK_CONSTANT
+	{ "self", TOKEN_SPACE_NONE }, // G_TK_SELF
+	{ nullptr, TOKEN_SPACE_NONE }, // G_TK_BUILT_IN_TYPE
+	{ nullptr, TOKEN_SPACE_NONE }, // G_TK_BUILT_IN_FUNC
+	{ "in ", TOKEN_SPACE_BEFORE }, // G_TK_OP_IN
+	{ "== ", TOKEN_SPACE_BEFORE }, // G_TK_OP_EQUAL
+	{ "!= ", TOKEN_SPACE_BEFORE }, // G_TK_OP_NOT_EQUAL
+	{ "< ", TOKEN_SPACE_BEFORE }, // G_TK_OP_LESS
+	{ "<= ", TOKEN_SPACE_BEFORE }, // G_TK_OP_LESS_EQUAL
+	{ "> ", TOKEN_SPACE_BEFORE }, // G_TK_OP_GREATER
+	{ ">= ", TOKEN_SPACE_BEFORE }, // G_TK_OP_GREATER_EQUAL
+	{ "and ", TOKEN_SPACE_BEFORE }, // G_TK_OP_AND
+	{ "or ", TOKEN_SPACE_BEFORE }, // G_TK_OP_OR
+	{ "not ", TOKEN_SPACE_BEFORE }, // G_TK_OP_NOT
+	{ "+ ", TOKEN_SPACE_BEFORE }, // G_TK_OP_ADD
+	{ "- ", TOKEN_SPACE_BEFORE_IF_NOT_LINE_START }, // G_TK_OP_SUB
+	{ "* ", TOKEN_SPACE_BEFORE }, // G_TK_OP_MUL
+	{ "/ ", TOKEN_SPACE_BEFORE }, // G_TK_OP_DIV
+	{ "% ", TOKEN_SPACE_BEFORE }, // G_TK_OP_MOD
+	{ "<< ", TOKEN_SPACE_BEFORE }, // G_TK_OP_SHIFT_LEFT
+	{ ">> ", TOKEN_SPACE_BEFORE }, // G_TK_OP_SHIFT_RIGHT
+	{ "= ", TOKEN_SPACE_BEFORE }, // G_TK_OP_ASSIGN
+	{ "+= ", TOKEN_SPACE_BEFORE }, // G_TK_OP_ASSIGN_ADD
+	{ "-= ", TOKEN_SPACE_BEFORE }, // G_TK_OP_ASSIGN_SUB
+	{ "*= ", TOKEN_SPACE_BEFORE }, // G_TK_OP_ASSIGN_MUL
+	{ "/= ", TOKEN_SPACE_BEFORE }, // G_TK_OP_ASSIGN_DIV
+	{ "%= ", TOKEN_SPACE_BEFORE }, // G_TK_OP_ASSIGN_MOD
+	{ "<<= ", TOKEN_SPACE_BEFORE }, // G_TK_OP_ASSIGN_SHIFT_LEFT
+	{ ">>= ", TOKEN_SPACE_BEFORE }, // G_TK_OP_ASSIGN_SHIFT_RIGHT
+	{ "&= ", TOKEN_SPACE_BEFORE }, // G_TK_OP_ASSIGN_BIT_AND
+	{ "|= ", TOKEN_SPACE_BEFORE }, // G_TK_OP_ASSIGN_BIT_OR
+	{ "^= ", TOKEN_SPACE_BEFORE }, // G_TK_OP_ASSIGN_BIT_XOR
+	{ "& ", TOKEN_SPACE_BEFORE }, // G_TK_OP_BIT_AND
+	{ "| ", TOKEN_SPACE_BEFORE }, // G_TK_OP_BIT_OR
+	{ "^ ", TOKEN_SPACE_BEFORE }, // G_TK_OP_BIT_XOR
+	{ "~ ", TOKEN_SPACE_BEFORE }, // G_TK_OP_BIT_INVERT
+	{ "if ", TOKEN_SPACE_BEFORE_IF_NOT_LINE_START }, // G_TK_CF_IF
+	{ "elif ", TOKEN_SPACE_NONE }, // G_TK_CF_ELIF
+	{ "else ", TOKEN_SPACE_BEFORE_IF_NOT_LINE_START }, // G_TK_CF_ELSE
+	{ "for ", TOKEN_SPACE_NONE }, // G_TK_CF_FOR
+	{ "do ", TOKEN_SPACE_NONE }, // G_TK_CF_DO
+	{ "while ", TOKEN_SPACE_NONE }, // G_TK_CF_WHILE
+	{ "swith ", TOKEN_SPACE_NONE }, // G_TK_CF_SWITCH
+	{ "case ", TOKEN_SPACE_NONE }, // G_TK_CF_CASE
+	{ "break", TOKEN_SPACE_NONE }, // G_TK_CF_BREAK
+	{ "continue", TOKEN_SPACE_NONE }, // G_TK_CF_CONTINUE
+	{ "pass", TOKEN_SPACE_NONE }, // G_TK_CF_PASS
+	{ "return ", TOKEN_SPACE_NONE }, // G_TK_CF_RETURN
+	{ "match ", TOKEN_SPACE_NONE }, // G_TK_CF_MATCH
+	{ "func ", TOKEN_SPACE_NONE }, // G_TK_PR_FUNCTION
+	{ "class ", TOKEN_SPACE_NONE }, // G_TK_PR_CLASS
+	{ "class_name ", TOKEN_SPACE_NONE }, // G_TK_PR_CLASS_NAME
+	{ "extends ", TOKEN_SPACE_BEFORE_IF_NOT_LINE_START }, // G_TK_PR_EXTENDS
+	{ "is ", TOKEN_SPACE_BEFORE }, // G_TK_PR_IS
+	{ "onready ", TOKEN_SPACE_NONE }, // G_TK_PR_ONREADY
+	{ "tool ", TOKEN_SPACE_NONE }, // G_TK_PR_TOOL
+	{ "static ", TOKEN_SPACE_NONE }, // G_TK_PR_STATIC
+	{ "export ", TOKEN_SPACE_NONE }, // G_TK_PR_EXPORT
+	{ " setget ", TOKEN_SPACE_NONE }, // G_TK_PR_SETGET
+	{ "const ", TOKEN_SPACE_NONE }, // G_TK_PR_CONST
+	{ nullptr, TOKEN_SPACE_NONE }, // G_TK_PR_VAR
+	{ "as ", TOKEN_SPACE_BEFORE }, // G_TK_PR_AS
+	{ "void ", TOKEN_SPACE_NONE }, // G_TK_PR_VOID
+	{ "enum ", TOKEN_SPACE_NONE }, // G_TK_PR_ENUM
+	{ "preload", TOKEN_SPACE_NONE }, // G_TK_PR_PRELOAD
+	{ "assert ", TOKEN_SPACE_NONE }, // G_TK_PR_ASSERT
+	{ "yield ", TOKEN_SPACE_NONE }, // G_TK_PR_YIELD
+	{ "signal ", TOKEN_SPACE_NONE }, // G_TK_PR_SIGNAL
+	{ "breakpoint ", TOKEN_SPACE_NONE }, // G_TK_PR_BREAKPOINT
+	{ "remote ", TOKEN_SPACE_NONE }, // G_TK_PR_REMOTE
+	{ "sync ", TOKEN_SPACE_NONE }, // G_TK_PR_SYNC
+	{ "master ", TOKEN_SPACE_NONE }, // G_TK_PR_MASTER
+	{ "slave ", TOKEN_SPACE_NONE }, // G_TK_PR_SLAVE
+	{ "puppet ", TOKEN_SPACE_NONE }, // G_TK_PR_PUPPET
+	{ "remotesync ", TOKEN_SPACE_NONE }, // G_TK_PR_REMOTESYNC
+	{ "mastersync ", TOKEN_SPACE_NONE }, // G_TK_PR_MASTERSYNC
+	{ "slavesync ", TOKEN_SPACE_NONE }, // G_TK_PR_SLAVESYNC
+	{ "puppetsync ", TOKEN_SPACE_NONE }, // G_TK_PR_PUPPETSYNC
+	{ "[", TOKEN_SPACE_NONE }, // G_TK_BRACKET_OPEN
+	{ "]", TOKEN_SPACE_NONE }, // G_TK_BRACKET_CLOSE
+	{ "{", TOKEN_SPACE_NONE }, // G_TK_CURLY_BRACKET_OPEN
+	{ "}", TOKEN_SPACE_NONE }, // G_TK_CURLY_BRACKET_CLOSE
+	{ "(", TOKEN_SPACE_NONE }, // G_TK_PARENTHESIS_OPEN
+	{ ")", TOKEN_SPACE_NONE }, // G_TK_PARENTHESIS_CLOSE
+	{ ", ", TOKEN_SPACE_NONE }, // G_TK_COMMA
+	{ ";", TOKEN_SPACE_NONE }, // G_TK_SEMICOLON
+	{ ".", TOKEN_SPACE_NONE }, // G_TK_PERIOD
+	{ "?", TOKEN_SPACE_NONE }, // G_TK_QUESTION_MARK
+	{ ":", TOKEN_SPACE_NONE }, // G_TK_COLON
+	{ "$", TOKEN_SPACE_NONE }, // G_TK_DOLLAR
+	{ "->", TOKEN_SPACE_NONE }, // G_TK_FORWARD_ARROW
+	{ nullptr, TOKEN_SPACE_NONE }, // G_TK_NEWLINE
+	{ "PI", TOKEN_SPACE_NONE }, // G_TK_CONST_PI
+	{ "TAU", TOKEN_SPACE_NONE }, // G_TK_CONST_TAU
+	{ "_", TOKEN_SPACE_NONE }, // G_TK_WILDCARD
+	{ "INF", TOKEN_SPACE_NONE }, // G_TK_CONST_INF
+	{ "NAN", TOKEN_SPACE_NONE }, // G_TK_CONST_NAN
+	{ nullptr, TOKEN_SPACE_NONE }, // G_TK_ERROR
+	{ nullptr, TOKEN_SPACE_NONE }, // G_TK_EOF
+	{ nullptr, TOKEN_SPACE_NONE }, // G_TK_CURSOR
+	{ nullptr, TOKEN_SPACE_NONE }, // G_TK_MAX
+};
+
+static_assert(sizeof(token_texts) / sizeof(token_texts[0]) == GDScriptDecomp::G_TK_MAX + 1, "token_texts must have an entry for every global token");
+
+Error GDScriptDecomp::decompile_buffer(Vector<uint8_t> p_buffer) {
+	ERR_FAIL_COND_V_MSG(!builtin_func_names, ERR_UNCONFIGURED, "Bytecode revision tables were not set.");
+
+	//Cleanup
+	script_text = String();
+
+	//Load bytecode
+	GDSCTokenStream stream;
+	Error err = parse_token_stream(p_buffer, bytecode_version, stream);
+	if (err) {
+		return err;
+	}
+	const Vector<uint32_t> &tokens = stream.get_tokens();
+
+	//Decompile script
+	String line;
+	int indent = 0;
+
+	GlobalToken prev_token = G_TK_NEWLINE;
+	for (int i = 0; i < tokens.size(); i++) {
+		GlobalToken curr_token = get_global_token(tokens[i]);
+		switch (curr_token) {
+			case G_TK_IDENTIFIER: {
+				uint32_t identifier = tokens[i] >> TOKEN_BITS;
+				ERR_FAIL_COND_V(identifier >= (uint32_t)stream.get_identifier_count(), ERR_INVALID_DATA);
+				line += stream.get_identifier(identifier);
+			} break;
+			case G_TK_CONSTANT: {
+				uint32_t constant = tokens[i] >> TOKEN_BITS;
+				ERR_FAIL_COND_V(constant >= (uint32_t)stream.get_constant_count(), ERR_INVALID_DATA);
+				line += get_constant_string(stream.get_constants(), constant);
+			} break;
+			case G_TK_BUILT_IN_TYPE: {
+				line += VariantDecoderCompat::get_variant_type_name(tokens[i] >> TOKEN_BITS, variant_ver_major);
+			} break;
+			case G_TK_BUILT_IN_FUNC: {
+				uint32_t func_id = tokens[i] >> TOKEN_BITS;
+				ERR_FAIL_COND_V(func_id >= (uint32_t)builtin_func_count, ERR_INVALID_DATA);
+				line += builtin_func_names[func_id];
+			} break;
+			case G_TK_PR_VAR: {
+				if (line != String() && prev_token != G_TK_PR_ONREADY) {
+					line += " ";
+				}
+				line += "var ";
+			} break;
+			case G_TK_NEWLINE: {
+				for (int j = 0; j < indent; j++) {
+					script_text += "\t";
+				}
+				script_text += line + "\n";
+				line = String();
+				indent = tokens[i] >> TOKEN_BITS;
+			} break;
+			default: {
+				const TokenText &token_text = token_texts[curr_token];
+				if (!token_text.text) {
+					break; // skip - empty or invalid
+				}
+				if (token_text.spacing == TOKEN_SPACE_BEFORE || (token_text.spacing == TOKEN_SPACE_BEFORE_IF_NOT_LINE_START && prev_token != G_TK_NEWLINE)) {
+					_ensure_space(line);
+				} else if (space_before_if_else && (curr_token == G_TK_CF_IF || curr_token == G_TK_CF_ELSE)) {
+					_ensure_space(line);
+				}
+				line += token_text.text;
+			} break;
+		}
+		prev_token = curr_token;
+	}
+
+	if (!line.is_empty()) {
+		for (int j = 0; j < indent; j++) {
+			script_text += "\t";
+		}
+		script_text += line + "\n";
+	}
+
+	if (script_text == String()) {
+		error_message = RTR("Invalid token");
+		return ERR_INVALID_DATA;
+	}
+
+	return OK;
+}
+
 Error GDScriptDecomp::decompile_byte_code_encrypted(const String &p_path, Vector<uint8_t> p_key) {
 	Vector<uint8_t> bytecode;
 	Error err = get_buffer_encrypted(p_path, engine_ver_major, p_key, bytecode);
@@ -224,7 +519,7 @@ String GDScriptDecomp::get_error_message() {
 	return error_message;
 }
 
-String GDScriptDecomp::get_constant_string(Vector<Variant> &constants, uint32_t constId) {
+String GDScriptDecomp::get_constant_string(const Vector<Variant> &constants, uint32_t constId) {
 	String constString;
 	Error err = VariantWriterCompat::write_to_string(constants[constId], constString, variant_ver_major);
 	ERR_FAIL_COND_V(err, "");
@@ -234,84 +529,22 @@ String GDScriptDecomp::get_constant_string(Vector<Variant> &constants, uint32_t
 	return constString;
 }
 
-Error GDScriptDecomp::get_ids_consts_tokens(const Vector<uint8_t> &p_buffer, int bytecode_version, Vector<StringName> &identifiers, Vector<Variant> &constants, Vector<uint32_t> &tokens) {
-	//Load bytecode
-	VMap<uint32_t, uint32_t> lines;
-
-	const uint8_t *buf = p_buffer.ptr();
-	int total_len = p_buffer.size();
-	ERR_FAIL_COND_V(p_buffer.size() < 24 || p_buffer[0] != 'G' || p_buffer[1] != 'D' || p_buffer[2] != 'S' || p_buffer[3] != 'C', ERR_INVALID_DATA);
-
-	int version = decode_uint32(&buf[4]);
-	if (version != bytecode_version) {
-		ERR_FAIL_COND_V(version > bytecode_version, ERR_INVALID_DATA);
-	}
-	int identifier_count = decode_uint32(&buf[8]);
-	int constant_count = decode_uint32(&buf[12]);
-	int line_count = decode_uint32(&buf[16]);
-	int token_count = decode_uint32(&buf[20]);
-
-	const uint8_t *b = &buf[24];
-	total_len -= 24;
-
-	identifiers.resize(identifier_count);
-	for (int i = 0; i < identifier_count; i++) {
-		int len = decode_uint32(b);
-		ERR_FAIL_COND_V(len > total_len, ERR_INVALID_DATA);
-		b += 4;
-		Vector<uint8_t> cs;
-		cs.resize(len);
-		for (int j = 0; j < len; j++) {
-			cs.write[j] = b[j] ^ 0xb6;
-		}
-
-		cs.write[cs.size() - 1] = 0;
-		String s;
-		s.parse_utf8((const char *)cs.ptr());
-		b += len;
-		total_len -= len + 4;
-		identifiers.write[i] = s;
-	}
-
-	constants.resize(constant_count);
-	for (int i = 0; i < constant_count; i++) {
-		Variant v;
-		int len;
-		Error err = VariantDecoderCompat::decode_variant_compat(variant_ver_major, v, b, total_len, &len);
-		if (err) {
-			error_message = RTR("Invalid constant");
-			return err;
-		}
-		b += len;
-		total_len -= len;
-		constants.write[i] = v;
-	}
-
-	ERR_FAIL_COND_V(line_count * 8 > total_len, ERR_INVALID_DATA);
-
-	for (int i = 0; i < line_count; i++) {
-		uint32_t token = decode_uint32(b);
-		b += 4;
-		uint32_t linecol = decode_uint32(b);
-		b += 4;
-
-		lines.insert(token, linecol);
-		total_len -= 8;
-	}
-	tokens.resize(token_count);
-	for (int i = 0; i < token_count; i++) {
-		ERR_FAIL_COND_V(total_len < 1, ERR_INVALID_DATA);
+GDScriptDecomp::BYTECODE_TEST_RESULT GDScriptDecomp::test_bytecode(Vector<uint8_t> p_buffer) {
+	GDSCTokenStream stream;
+	Error err = parse_token_stream(p_buffer, bytecode_version, stream);
+	ERR_FAIL_COND_V_MSG(err != OK, BYTECODE_TEST_RESULT::BYTECODE_TEST_CORRUPT, "Failed to get identifiers, constants, and tokens from bytecode.");
+	return test_token_stream(stream);
+}
 
-		if ((*b) & 0x80) { //BYTECODE_MASK, little endian always
-			ERR_FAIL_COND_V(total_len < 4, ERR_INVALID_DATA);
+// not implemented for most revisions
+GDScriptDecomp::BYTECODE_TEST_RESULT GDScriptDecomp::test_token_stream(const GDSCTokenStream &p_stream) const {
+	return BYTECODE_TEST_RESULT::BYTECODE_TEST_UNKNOWN;
+}
 
-			tokens.write[i] = decode_uint32(b) & ~0x80;
-			b += 4;
-		} else {
-			tokens.write[i] = *b;
-			b += 1;
-			total_len--;
-		}
+Error GDScriptDecomp::parse_token_stream(const Vector<uint8_t> &p_buffer, int bytecode_version, GDSCTokenStream &r_stream) {
+	Error err = r_stream.parse(p_buffer, bytecode_version, variant_ver_major);
+	if (err && !r_stream.get_error_message().is_empty()) {
+		error_message = r_stream.get_error_message();
 	}
-	return OK;
-}
\ No newline at end of file
+	return err;
+}
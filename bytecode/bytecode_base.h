@@ -5,6 +5,7 @@
 #ifndef GDSCRIPT_DECOMP_H
 #define GDSCRIPT_DECOMP_H
 
+#include "bytecode/gdsc_token_stream.h"
 #include "compat/variant_decoder_compat.h"
 
 #include "core/object/class_db.h"
@@ -15,17 +16,154 @@
 class GDScriptDecomp : public Object {
 	GDCLASS(GDScriptDecomp, Object);
 
+public:
+	// Superset of the tokens of every bytecode revision; each revision maps its own token ids onto these
+	enum GlobalToken {
+		G_TK_EMPTY,
+		G_TK_IDENTIFIER,
+		G_TK_CONSTANT,
+		G_TK_SELF,
+		G_TK_BUILT_IN_TYPE,
+		G_TK_BUILT_IN_FUNC,
+		G_TK_OP_IN,
+		G_TK_OP_EQUAL,
+		G_TK_OP_NOT_EQUAL,
+		G_TK_OP_LESS,
+		G_TK_OP_LESS_EQUAL,
+		G_TK_OP_GREATER,
+		G_TK_OP_GREATER_EQUAL,
+		G_TK_OP_AND,
+		G_TK_OP_OR,
+		G_TK_OP_NOT,
+		G_TK_OP_ADD,
+		G_TK_OP_SUB,
+		G_TK_OP_MUL,
+		G_TK_OP_DIV,
+		G_TK_OP_MOD,
+		G_TK_OP_SHIFT_LEFT,
+		G_TK_OP_SHIFT_RIGHT,
+		G_TK_OP_ASSIGN,
+		G_TK_OP_ASSIGN_ADD,
+		G_TK_OP_ASSIGN_SUB,
+		G_TK_OP_ASSIGN_MUL,
+		G_TK_OP_ASSIGN_DIV,
+		G_TK_OP_ASSIGN_MOD,
+		G_TK_OP_ASSIGN_SHIFT_LEFT,
+		G_TK_OP_ASSIGN_SHIFT_RIGHT,
+		G_TK_OP_ASSIGN_BIT_AND,
+		G_TK_OP_ASSIGN_BIT_OR,
+		G_TK_OP_ASSIGN_BIT_XOR,
+		G_TK_OP_BIT_AND,
+		G_TK_OP_BIT_OR,
+		G_TK_OP_BIT_XOR,
+		G_TK_OP_BIT_INVERT,
+		G_TK_CF_IF,
+		G_TK_CF_ELIF,
+		G_TK_CF_ELSE,
+		G_TK_CF_FOR,
+		G_TK_CF_DO,
+		G_TK_CF_WHILE,
+		G_TK_CF_SWITCH,
+		G_TK_CF_CASE,
+		G_TK_CF_BREAK,
+		G_TK_CF_CONTINUE,
+		G_TK_CF_PASS,
+		G_TK_CF_RETURN,
+		G_TK_CF_MATCH,
+		G_TK_PR_FUNCTION,
+		G_TK_PR_CLASS,
+		G_TK_PR_CLASS_NAME,
+		G_TK_PR_EXTENDS,
+		G_TK_PR_IS,
+		G_TK_PR_ONREADY,
+		G_TK_PR_TOOL,
+		G_TK_PR_STATIC,
+		G_TK_PR_EXPORT,
+		G_TK_PR_SETGET,
+		G_TK_PR_CONST,
+		G_TK_PR_VAR,
+		G_TK_PR_AS,
+		G_TK_PR_VOID,
+		G_TK_PR_ENUM,
+		G_TK_PR_PRELOAD,
+		G_TK_PR_ASSERT,
+		G_TK_PR_YIELD,
+		G_TK_PR_SIGNAL,
+		G_TK_PR_BREAKPOINT,
+		G_TK_PR_REMOTE,
+		G_TK_PR_SYNC,
+		G_TK_PR_MASTER,
+		G_TK_PR_SLAVE,
+		G_TK_PR_PUPPET,
+		G_TK_PR_REMOTESYNC,
+		G_TK_PR_MASTERSYNC,
+		G_TK_PR_SLAVESYNC,
+		G_TK_PR_PUPPETSYNC,
+		G_TK_BRACKET_OPEN,
+		G_TK_BRACKET_CLOSE,
+		G_TK_CURLY_BRACKET_OPEN,
+		G_TK_CURLY_BRACKET_CLOSE,
+		G_TK_PARENTHESIS_OPEN,
+		G_TK_PARENTHESIS_CLOSE,
+		G_TK_COMMA,
+		G_TK_SEMICOLON,
+		G_TK_PERIOD,
+		G_TK_QUESTION_MARK,
+		G_TK_COLON,
+		G_TK_DOLLAR,
+		G_TK_FORWARD_ARROW,
+		G_TK_NEWLINE,
+		G_TK_CONST_PI,
+		G_TK_CONST_TAU,
+		G_TK_WILDCARD,
+		G_TK_CONST_INF,
+		G_TK_CONST_NAN,
+		G_TK_ERROR,
+		G_TK_EOF,
+		G_TK_CURSOR,
+		G_TK_MAX,
+	};
+
 protected:
+	enum {
+		TOKEN_BYTE_MASK = 0x80,
+		TOKEN_BITS = 8,
+		TOKEN_MASK = (1 << TOKEN_BITS) - 1,
+		TOKEN_LINE_BITS = 24,
+		TOKEN_LINE_MASK = (1 << TOKEN_LINE_BITS) - 1,
+	};
+
 	static void _bind_methods();
 	static void _ensure_space(String &p_code);
 
 	String script_text;
 	String error_message;
 	uint64_t bytecode_rev;
+	int bytecode_version = 0;
 	int engine_ver_major;
 	int variant_ver_major; // Some early dev versions of 3.0 used v2 variants, and early dev versions of 4.0 used v3 variants
+	bool space_before_if_else = false; // 1.0 also put a space before "if" and "else" at the start of a line
 
-	Pair<int, int> get_arg_count_for_builtin(String builtin_func_name);
+	// Per-revision descriptor tables, set by the revision's constructor
+	GlobalToken token_map[TOKEN_MASK + 1];
+	const char **builtin_func_names = nullptr;
+	int builtin_func_count = 0;
+	// (min, max) arg count of each builtin function by function id, (-1, -1) if unknown
+	Vector<Pair<int, int>> builtin_func_arg_counts;
+
+	void _set_revision_tables(const GlobalToken *p_tokens, int p_token_count, const char **p_func_names, int p_func_count);
+	template <size_t T, size_t F>
+	void set_revision_tables(const GlobalToken (&p_tokens)[T], const char *(&p_func_names)[F]) {
+		_set_revision_tables(p_tokens, (int)T, p_func_names, (int)F);
+	}
+
+	_FORCE_INLINE_ GlobalToken get_global_token(uint32_t p_token) const { return token_map[p_token & TOKEN_MASK]; }
+
+	Pair<int, int> get_arg_count_for_builtin(const String &builtin_func_name) const;
+	_FORCE_INLINE_ Pair<int, int> get_builtin_func_arg_count(int p_func_id) const {
+		return p_func_id >= 0 && p_func_id < builtin_func_arg_counts.size() ? builtin_func_arg_counts[p_func_id] : Pair<int, int>(-1, -1);
+	}
+	bool test_built_in_func_arg_count(const Vector<uint32_t> &p_tokens, Pair<int, int> p_arg_count, int &r_pos) const;
 
 public:
 	enum BYTECODE_TEST_RESULT {
@@ -35,8 +173,20 @@ public:
 		BYTECODE_TEST_UNKNOWN,
 	};
 
-	virtual Error decompile_buffer(Vector<uint8_t> p_buffer) = 0;
-	virtual BYTECODE_TEST_RESULT test_bytecode(Vector<uint8_t> p_buffer) = 0;
+	virtual Error decompile_buffer(Vector<uint8_t> p_buffer);
+	BYTECODE_TEST_RESULT test_bytecode(Vector<uint8_t> p_buffer);
+	// Tests an already parsed stream, so that one parse can be shared between several revisions.
+	// This only reads the revision tables, so it is safe to call from multiple threads at once.
+	virtual BYTECODE_TEST_RESULT test_token_stream(const GDSCTokenStream &p_stream) const;
+
+	// (min, max) arg count of a builtin function from the revision's table, and looked up by name; (-1, -1) if unknown
+	Vector2i get_function_arg_count(int p_func_id) const;
+	Vector2i get_function_arg_count_by_name(const String &p_func_name) const;
+
+	uint64_t get_bytecode_rev() const { return bytecode_rev; }
+	int get_bytecode_version() const { return bytecode_version; }
+	int get_engine_ver_major() const { return engine_ver_major; }
+	int get_variant_ver_major() const { return variant_ver_major; }
 
 	Error decompile_byte_code_encrypted(const String &p_path, Vector<uint8_t> p_key);
 	Error decompile_byte_code(const String &p_path);
@@ -44,8 +194,8 @@ public:
 	static Error get_buffer_encrypted(const String &p_path, int engine_ver_major, Vector<uint8_t> p_key, Vector<uint8_t> &r_buffer);
 	String get_script_text();
 	String get_error_message();
-	String get_constant_string(Vector<Variant> &constants, uint32_t constId);
-	Error get_ids_consts_tokens(const Vector<uint8_t> &p_buffer, int bytecode_version, Vector<StringName> &r_identifiers, Vector<Variant> &r_constants, Vector<uint32_t> &r_tokens);
+	String get_constant_string(const Vector<Variant> &constants, uint32_t constId);
+	Error parse_token_stream(const Vector<uint8_t> &p_buffer, int bytecode_version, GDSCTokenStream &r_stream);
 };
 
 #endif
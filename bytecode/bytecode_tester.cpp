@@ -1,7 +1,9 @@
 #include "bytecode_tester.h"
 #include "bytecode_versions.h"
 #include "core/io/file_access.h"
-// We are only using this to test 2.1.x and 3.1.x currently.
+#include "core/io/marshalls.h"
+#include "core/object/worker_thread_pool.h"
+// Only the 2.1.x and 3.1.x revisions currently have meaningful tests, every other revision reports BYTECODE_TEST_UNKNOWN.
 
 /***********2.1 testing ********
  discontintuities in the functions for bytecode 10 starts here (-1 means varargs):
@@ -144,259 +146,229 @@ built-in func divergence for bytecode version 13 (3.1.x only)
 // TODO: add this
 */
 
-uint64_t test_files_2_1(const Vector<String> &p_paths) {
-	uint64_t rev = 0;
-	bool ed80f45_failed = false;
-	bool ed80f45_passed = false;
-	bool _85585c7_failed = false;
-	bool _85585c7_passed = false;
-	bool _7124599_failed = false;
-	bool _7124599_passed = false;
-	GDScriptDecomp_ed80f45 *decomp_ed80f45 = memnew(GDScriptDecomp_ed80f45);
-	GDScriptDecomp_85585c7 *decomp_85585c7 = memnew(GDScriptDecomp_85585c7);
-	GDScriptDecomp_7124599 *decomp_7124599 = memnew(GDScriptDecomp_7124599);
-	for (String path : p_paths) {
-		Vector<uint8_t> data = FileAccess::get_file_as_bytes(path);
-		if (data.size() == 0) {
+// Tests the release/beta revisions of one engine version against a set of scripts.
+// Files are tested in batches on the worker thread pool; each file is read and parsed once and the
+// stream is shared between all of the candidates. The results are merged in file order, so the outcome
+// doesn't depend on the number of threads, and testing stops as soon as the revision is known.
+class BytecodeTestRunner {
+	struct Candidate {
+		GDScriptDecomp *decomp = nullptr;
+		bool failed = false;
+		bool passed = false;
+	};
+
+	Vector<String> paths;
+	Vector<uint8_t> key;
+	int ver_major = 0;
+	int ver_minor = 0;
+	// newest first, same order as decomp_versions
+	Vector<Candidate> candidates;
+	int batch_start = 0;
+	Vector<Error> file_errors;
+
+	void _test_file(uint32_t p_idx, uint8_t *r_results);
+	// the newest candidate that hasn't failed; if that one passed, nothing else can change the outcome
+	int _get_newest_remaining() const;
+	int _get_remaining_count() const;
+
+public:
+	uint64_t run();
+
+	BytecodeTestRunner(const Vector<String> &p_paths, const Vector<uint8_t> &p_key, int p_ver_major, int p_ver_minor);
+	~BytecodeTestRunner();
+};
+
+BytecodeTestRunner::BytecodeTestRunner(const Vector<String> &p_paths, const Vector<uint8_t> &p_key, int p_ver_major, int p_ver_minor) :
+		paths(p_paths), key(p_key), ver_major(p_ver_major), ver_minor(p_ver_minor) {
+	for (int i = 0; decomp_versions[i].commit != 0; i++) {
+		if (decomp_versions[i].commit == 0xfffffff) {
 			continue;
 		}
-		if (!ed80f45_failed && !ed80f45_passed) {
-			auto test_result = decomp_ed80f45->test_bytecode(data);
-			switch (test_result) {
-				case GDScriptDecomp::BYTECODE_TEST_RESULT::BYTECODE_TEST_FAIL:
-					ed80f45_failed = true;
-					break;
-				case GDScriptDecomp::BYTECODE_TEST_RESULT::BYTECODE_TEST_PASS:
-					// we don't need to test further, this revision is the highest possible for bytecode version 10
-					ed80f45_passed = true;
-					rev = 0xed80f45;
-					break;
-				case GDScriptDecomp::BYTECODE_TEST_RESULT::BYTECODE_TEST_CORRUPT:
-					WARN_PRINT("BYTECODE_TEST_CORRUPT test result for ed80f45, script " + path);
-					ed80f45_failed = true;
-					break;
-				default:
-					break;
-			}
+		// dev revisions don't have tests and could never be ruled out
+		String name = decomp_versions[i].name.strip_edges();
+		if (name.find(" dev ") != -1) {
+			continue;
 		}
-		if (!_85585c7_failed && !_85585c7_passed) {
-			auto test_result = decomp_85585c7->test_bytecode(data);
-			switch (test_result) {
-				case GDScriptDecomp::BYTECODE_TEST_RESULT::BYTECODE_TEST_FAIL:
-					_85585c7_failed = true;
-					break;
-				case GDScriptDecomp::BYTECODE_TEST_RESULT::BYTECODE_TEST_PASS:
-					_85585c7_passed = true;
-					if (ed80f45_failed) {
-						// no need to go further
-						rev = 0x85585c7;
-					}
-					break;
-				case GDScriptDecomp::BYTECODE_TEST_RESULT::BYTECODE_TEST_CORRUPT:
-					WARN_PRINT("BYTECODE_TEST_CORRUPT test result for 85585c7, script " + path);
-					_85585c7_failed = true;
-					break;
-				default:
-					break;
-			}
+		// "2.1.3 - 2.1.6 release (...", "3.1 beta 1 - beta 5 (...", etc.
+		Vector<String> ver = name.get_slice(" ", 0).split(".");
+		if (ver.size() < 2 || ver[0].to_int() != ver_major || ver[1].to_int() != ver_minor) {
+			continue;
 		}
-		if (!_7124599_failed && !_7124599_passed) {
-			auto test_result = decomp_7124599->test_bytecode(data);
-			switch (test_result) {
-				case GDScriptDecomp::BYTECODE_TEST_RESULT::BYTECODE_TEST_FAIL:
-					_7124599_failed = true;
-					break;
-				case GDScriptDecomp::BYTECODE_TEST_RESULT::BYTECODE_TEST_PASS:
-					_7124599_passed = true; // doesn't currently have a pass case
-					break;
-				case GDScriptDecomp::BYTECODE_TEST_RESULT::BYTECODE_TEST_CORRUPT:
-					WARN_PRINT("BYTECODE_TEST_CORRUPT test result for 7124599, script " + path);
-					_7124599_failed = true;
-					break;
-				default:
-					break;
-			}
+		Candidate candidate;
+		candidate.decomp = create_decomp_for_commit(decomp_versions[i].commit);
+		if (candidate.decomp) {
+			candidates.push_back(candidate);
 		}
-		if (rev != 0) {
-			break;
+	}
+}
+
+BytecodeTestRunner::~BytecodeTestRunner() {
+	for (int i = 0; i < candidates.size(); i++) {
+		memdelete(candidates[i].decomp);
+	}
+}
+
+void BytecodeTestRunner::_test_file(uint32_t p_idx, uint8_t *r_results) {
+	const int candidate_count = candidates.size();
+	uint8_t *results = &r_results[p_idx * candidate_count];
+	for (int c = 0; c < candidate_count; c++) {
+		results[c] = GDScriptDecomp::BYTECODE_TEST_UNKNOWN;
+	}
+
+	const String &path = paths[batch_start + p_idx];
+	Vector<uint8_t> data;
+	if (key.size() > 0) {
+		Error err = GDScriptDecomp::get_buffer_encrypted(path, ver_major, key, data);
+		if (err) {
+			file_errors.write[p_idx] = err;
+			return;
 		}
-		if (ed80f45_failed && _85585c7_failed && _7124599_failed) {
-			// Welp
-			break;
+	} else {
+		data = FileAccess::get_file_as_bytes(path);
+	}
+	if (data.size() == 0) {
+		return;
+	}
+	if (data.size() < 8) {
+		for (int c = 0; c < candidate_count; c++) {
+			results[c] = GDScriptDecomp::BYTECODE_TEST_CORRUPT;
 		}
+		return;
 	}
-	if (rev == 0) {
-		if (!ed80f45_failed) {
-			if (_85585c7_passed) {
-				rev = 0x85585c7;
-				// major token changes in ed80f45, the others should have failed
-			} else if (_7124599_failed && _85585c7_failed) {
-				rev = 0xed80f45;
-			}
-		} else if (ed80f45_failed) {
-			// it's quite possible for both 85585c7 and 7124599 to not fail, as 85585c7 is testing ColorN, which came towards the end of the builtin_func list
-			// and our pass cases are pretty limited there.
-			// if the game doesn't use 	"ColorN", "print_stack", or "instance_from_id", neither will fail.
-			// in that case, it doesn't matter which one we pick, so we'll just use 85585c7.
-			if (!_85585c7_failed) {
-				rev = 0x85585c7;
-				// otherwise, it's probably 7124599
-			} else if (!_7124599_failed) {
-				rev = 0x7124599;
-			}
+	int file_bytecode_version = decode_uint32(&data.ptr()[4]);
+
+	GDSCTokenStream stream;
+	int parsed_variant_ver = -1;
+	Error parse_err = OK;
+	for (int c = 0; c < candidate_count; c++) {
+		const Candidate &candidate = candidates[c];
+		// only modified between batches
+		if (candidate.failed || candidate.passed) {
+			continue;
 		}
-		if (rev == 0) {
-			ERR_PRINT("Failed to detect GDScript revision for engine version 2.1.x, please report this issue on GitHub");
+		if (candidate.decomp->get_bytecode_version() != file_bytecode_version) {
+			results[c] = GDScriptDecomp::BYTECODE_TEST_FAIL;
+			continue;
 		}
+		if (parsed_variant_ver != candidate.decomp->get_variant_ver_major()) {
+			parsed_variant_ver = candidate.decomp->get_variant_ver_major();
+			parse_err = stream.parse(data, file_bytecode_version, parsed_variant_ver);
+		}
+		results[c] = parse_err ? GDScriptDecomp::BYTECODE_TEST_CORRUPT : candidate.decomp->test_token_stream(stream);
 	}
-	memdelete(decomp_ed80f45);
-	memdelete(decomp_85585c7);
-	memdelete(decomp_7124599);
-	return rev;
 }
 
-uint64_t test_files_3_1(const Vector<String> &p_paths, const Vector<uint8_t> &p_key = Vector<uint8_t>()) {
-	uint64_t rev = 0;
-	bool _514a3fb_failed = false;
-	bool _1a36141_failed = false;
-	bool _1a36141_passed = false;
-	bool _1ca61a3_failed = false;
-	bool _1ca61a3_passed = false;
-
-	GDScriptDecomp_514a3fb *decomp_514a3fb = memnew(GDScriptDecomp_514a3fb);
-	GDScriptDecomp_1a36141 *decomp_1a36141 = memnew(GDScriptDecomp_1a36141);
-	GDScriptDecomp_1ca61a3 *decomp_1ca61a3 = memnew(GDScriptDecomp_1ca61a3);
-
-	for (String path : p_paths) {
-		Vector<uint8_t> data;
-		if (p_key.size() > 0) {
-			Error err = GDScriptDecomp::get_buffer_encrypted(path, 3, p_key, data);
-			ERR_FAIL_COND_V_MSG(err == ERR_UNAUTHORIZED, 0, "Failed to decrypt file " + path + " (Did you set the correct key?)");
-			ERR_FAIL_COND_V_MSG(err != OK, 0, "Failed to read file " + path);
-		} else {
-			data = FileAccess::get_file_as_bytes(path);
+int BytecodeTestRunner::_get_newest_remaining() const {
+	for (int c = 0; c < candidates.size(); c++) {
+		if (!candidates[c].failed) {
+			return c;
 		}
-		if (data.size() == 0) {
-			continue;
+	}
+	return -1;
+}
+
+int BytecodeTestRunner::_get_remaining_count() const {
+	int count = 0;
+	for (int c = 0; c < candidates.size(); c++) {
+		if (!candidates[c].failed) {
+			count++;
 		}
-		if (!_514a3fb_failed) {
-			auto test_result = decomp_514a3fb->test_bytecode(data);
-			switch (test_result) {
-				case GDScriptDecomp::BYTECODE_TEST_RESULT::BYTECODE_TEST_FAIL:
-					_514a3fb_failed = true;
-					break;
-				case GDScriptDecomp::BYTECODE_TEST_RESULT::BYTECODE_TEST_PASS:
-					// we don't need to test further, this revision is the highest possible for bytecode version 13 (3.1)
-					rev = 0x514a3fb;
-					break;
-				case GDScriptDecomp::BYTECODE_TEST_RESULT::BYTECODE_TEST_CORRUPT:
-					WARN_PRINT("BYTECODE_TEST_CORRUPT test result for 514a3fb, script " + path);
-					_514a3fb_failed = true;
-					break;
-				default:
-					break;
+	}
+	return count;
+}
+
+uint64_t BytecodeTestRunner::run() {
+	const int candidate_count = candidates.size();
+	if (candidate_count == 0) {
+		return 0;
+	} else if (candidate_count == 1) {
+		return candidates[0].decomp->get_bytecode_rev();
+	}
+
+	int num_threads = WorkerThreadPool::get_singleton()->get_thread_count();
+	int batch_size = MAX(num_threads * 4, 16);
+	Vector<uint8_t> results;
+	results.resize(batch_size * candidate_count);
+	file_errors.resize(batch_size);
+
+	bool done = false;
+	for (batch_start = 0; batch_start < paths.size() && !done; batch_start += batch_size) {
+		int batch_count = MIN(batch_size, paths.size() - batch_start);
+		file_errors.fill(OK);
+		if (num_threads <= 1 || batch_count == 1) {
+			for (int i = 0; i < batch_count; i++) {
+				_test_file(i, results.ptrw());
 			}
+		} else {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(
+					this,
+					&BytecodeTestRunner::_test_file,
+					results.ptrw(),
+					batch_count, -1, true, SNAME("BytecodeTester::test_files"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		}
-		if (!_1a36141_failed && !_1a36141_passed) {
-			auto test_result = decomp_1a36141->test_bytecode(data);
-			switch (test_result) {
-				case GDScriptDecomp::BYTECODE_TEST_RESULT::BYTECODE_TEST_FAIL:
-					_1a36141_failed = true;
-					break;
-				case GDScriptDecomp::BYTECODE_TEST_RESULT::BYTECODE_TEST_PASS:
-					_1a36141_passed = true;
-					if (_514a3fb_failed) {
-						// no need to go further
-						rev = 0x1a36141;
+
+		for (int i = 0; i < batch_count && !done; i++) {
+			const String &path = paths[batch_start + i];
+			ERR_FAIL_COND_V_MSG(file_errors[i] == ERR_UNAUTHORIZED, 0, "Failed to decrypt file " + path + " (Did you set the correct key?)");
+			ERR_FAIL_COND_V_MSG(file_errors[i] != OK, 0, "Failed to read file " + path);
+			const uint8_t *file_results = &results.ptr()[i * candidate_count];
+			for (int c = 0; c < candidate_count; c++) {
+				Candidate &candidate = candidates.write[c];
+				if (candidate.failed || candidate.passed) {
+					continue;
+				}
+				switch (file_results[c]) {
+					case GDScriptDecomp::BYTECODE_TEST_FAIL:
+						candidate.failed = true;
 						break;
-					}
-					break;
-				case GDScriptDecomp::BYTECODE_TEST_RESULT::BYTECODE_TEST_CORRUPT:
-					WARN_PRINT("BYTECODE_TEST_CORRUPT test result for 1a36141, script " + path);
-					_1a36141_failed = true;
-					break;
-				default:
-					break;
-			}
-		}
-		if (!_1ca61a3_failed && !_1ca61a3_passed) {
-			auto test_result = decomp_1ca61a3->test_bytecode(data);
-			switch (test_result) {
-				case GDScriptDecomp::BYTECODE_TEST_RESULT::BYTECODE_TEST_FAIL:
-					_1ca61a3_failed = true;
-					break;
-				case GDScriptDecomp::BYTECODE_TEST_RESULT::BYTECODE_TEST_PASS:
-					_1ca61a3_passed = true;
-					if (_514a3fb_failed && _1a36141_failed) {
-						// no need to go further
-						rev = 0x1ca61a3;
+					case GDScriptDecomp::BYTECODE_TEST_PASS:
+						candidate.passed = true;
 						break;
-					}
-					break;
-				case GDScriptDecomp::BYTECODE_TEST_RESULT::BYTECODE_TEST_CORRUPT:
-					WARN_PRINT("BYTECODE_TEST_CORRUPT test result for 1ca61a3, script " + path);
-					_1ca61a3_failed = true;
-					break;
-				default:
-					break;
+					case GDScriptDecomp::BYTECODE_TEST_CORRUPT:
+						WARN_PRINT("BYTECODE_TEST_CORRUPT test result for " + String::num_int64(candidate.decomp->get_bytecode_rev(), 16) + ", script " + path);
+						candidate.failed = true;
+						break;
+					default:
+						break;
+				}
+			}
+			int newest = _get_newest_remaining();
+			if (newest == -1 || candidates[newest].passed || _get_remaining_count() == 1) {
+				// Welp, or we found a match; no need to keep going
+				done = true;
 			}
-		}
-		if (rev != 0) {
-			// we found a match, no need to keep going
-			break;
-		}
-		if (_514a3fb_failed && _1a36141_failed && _1ca61a3_failed) {
-			// Welp
-			break;
 		}
 	}
 
-	if (rev == 0) {
-		if (!_514a3fb_failed && _1a36141_passed) {
-			rev = 0x1a36141;
-		} else if ((!_514a3fb_failed || !_1a36141_failed) && _1ca61a3_passed) {
-			rev = 0x1ca61a3;
-		} else if (!_514a3fb_failed && !_1a36141_failed && _1ca61a3_failed) { // there were major token changes in 3.1-beta, 1ca61a3 should have failed if the others didn't
-			// it likely will not matter which revision we use here, as they seem to have not used many built-in functions
-			// just use 3.1.1 (514a3fb), less than a month passed between 3.1.0 and 3.1.1
-			rev = 0x514a3fb;
-		} else if (_514a3fb_failed && !_1a36141_failed && _1a36141_failed) {
-			rev = 0x1a36141;
-		} else if (_514a3fb_failed && _1a36141_failed && !_1ca61a3_failed) {
-			rev = 0x1ca61a3;
-		} else {
-			// If we made it here, our current way of testing is insufficient, the user should report this.
-			ERR_FAIL_V_MSG(0, "Failed to detect GDScript revision for engine version 3.1.x, please report this issue on GitHub.");
+	// Prefer the newest remaining revision that passed; otherwise none of the remaining revisions used anything that
+	// differs between them, and it likely will not matter which one we use, so just use the newest.
+	// NOTE: The old hand-written 2.1/3.1 testers returned 0 for some of these ambiguous cases (e.g. 2.1 when ed80f45
+	// and an older revision both remained, or 3.1 when all three remained), which left the pack's patch number alone
+	// in GDRESettings::fix_patch_number(); now the newest remaining revision's patch number is used instead.
+	int newest = _get_newest_remaining();
+	for (int c = newest; c >= 0 && c < candidate_count; c++) {
+		if (!candidates[c].failed && candidates[c].passed) {
+			return candidates[c].decomp->get_bytecode_rev();
 		}
 	}
-
-	memdelete(decomp_514a3fb);
-	memdelete(decomp_1a36141);
-	memdelete(decomp_1ca61a3);
-	return rev;
+	if (newest != -1) {
+		return candidates[newest].decomp->get_bytecode_rev();
+	}
+	// If we made it here, our current way of testing is insufficient, the user should report this.
+	ERR_FAIL_V_MSG(0, "Failed to detect GDScript revision for engine version " + itos(ver_major) + "." + itos(ver_minor) + ".x, please report this issue on GitHub.");
 }
 
 uint64_t BytecodeTester::test_files(const Vector<String> &p_paths, int ver_major, int ver_minor) {
-	uint64_t rev = 0;
-	if (ver_major == 2 && ver_minor == 1) {
-		return test_files_2_1(p_paths);
-	} else if (ver_major == 3 && ver_minor == 1) {
-		return test_files_3_1(p_paths);
-	} else {
-		return 0;
-	}
-	return rev;
+	BytecodeTestRunner runner(p_paths, Vector<uint8_t>(), ver_major, ver_minor);
+	return runner.run();
 }
 
 uint64_t BytecodeTester::test_files_encrypted(const Vector<String> &p_paths, const Vector<uint8_t> &p_key, int ver_major, int ver_minor) {
-	uint64_t rev = 0;
 	if (ver_major <= 2) {
 		// 1-2 didn't have encrypted scripts....???
 		ERR_FAIL_V_MSG(0, "Encrypted scripts were not supported in Godot 1.x or 2.x.");
-	} else if (ver_major == 3 && ver_minor == 1) {
-		return test_files_3_1(p_paths, p_key);
-	} else {
-		return 0;
 	}
-	return rev;
-}
\ No newline at end of file
+	BytecodeTestRunner runner(p_paths, p_key, ver_major, ver_minor);
+	return runner.run();
+}
@@ -6,9 +6,10 @@
 
 class BytecodeTester {
 public:
-	// NOTE: This function is only implemented for testing 2.1 or 3.1 scripts. This returns 0 for everything else.
+	// Tests the release and beta revisions of ver_major.ver_minor and returns the detected revision, or 0 if none matched.
+	// NOTE: Only the 2.1 and 3.1 revisions currently have tests; for other versions with several candidates, this returns the newest one.
 	static uint64_t test_files(const Vector<String> &p_paths, int ver_major, int ver_minor);
 
-	// NOTE: This function is only implemented for testing 3.1 scripts (2.1 had no encryption scheme). This returns 0 for everything else.
+	// Same as test_files, for encrypted scripts (1.x and 2.x had no encryption scheme).
 	static uint64_t test_files_encrypted(const Vector<String> &p_paths, const Vector<uint8_t> &p_key, int ver_major, int ver_minor);
 };
\ No newline at end of file
@@ -0,0 +1,108 @@
+/*************************************************************************/
+/*  gdsc_token_stream.cpp                                                */
+/*************************************************************************/
+
+#include "gdsc_token_stream.h"
+#include "compat/variant_decoder_compat.h"
+
+#include "core/io/marshalls.h"
+
+void GDSCTokenStream::clear() {
+	buffer = Vector<uint8_t>();
+	bytecode_version = 0;
+	identifier_spans.clear();
+	constants.clear();
+	tokens.clear();
+	error_message = String();
+}
+
+Error GDSCTokenStream::parse(const Vector<uint8_t> &p_buffer, int p_max_bytecode_version, int p_variant_ver_major) {
+	clear();
+	// only takes a reference to the data
+	buffer = p_buffer;
+	const uint8_t *buf = buffer.ptr();
+	int total_len = buffer.size();
+	ERR_FAIL_COND_V(total_len < HEADER_SIZE || buf[0] != 'G' || buf[1] != 'D' || buf[2] != 'S' || buf[3] != 'C', ERR_INVALID_DATA);
+
+	bytecode_version = decode_uint32(&buf[4]);
+	ERR_FAIL_COND_V(bytecode_version > p_max_bytecode_version, ERR_INVALID_DATA);
+	int identifier_count = decode_uint32(&buf[8]);
+	int constant_count = decode_uint32(&buf[12]);
+	int line_count = decode_uint32(&buf[16]);
+	int token_count = decode_uint32(&buf[20]);
+	ERR_FAIL_COND_V(identifier_count < 0 || constant_count < 0 || line_count < 0 || token_count < 0, ERR_INVALID_DATA);
+
+	const uint8_t *b = &buf[HEADER_SIZE];
+	total_len -= HEADER_SIZE;
+
+	// identifiers are XOR'd with 0xb6 and null terminated; just record where they are for now
+	ERR_FAIL_COND_V((int64_t)identifier_count * 4 > total_len, ERR_INVALID_DATA);
+	identifier_spans.resize(identifier_count);
+	for (int i = 0; i < identifier_count; i++) {
+		ERR_FAIL_COND_V(total_len < 4, ERR_INVALID_DATA);
+		int len = decode_uint32(b);
+		b += 4;
+		total_len -= 4;
+		ERR_FAIL_COND_V(len < 0 || len > total_len, ERR_INVALID_DATA);
+		identifier_spans[i] = { int(b - buf), len };
+		b += len;
+		total_len -= len;
+	}
+
+	constants.resize(constant_count);
+	Variant *cw = constants.ptrw();
+	for (int i = 0; i < constant_count; i++) {
+		int len;
+		Error err = VariantDecoderCompat::decode_variant_compat(p_variant_ver_major, cw[i], b, total_len, &len);
+		if (err) {
+			error_message = RTR("Invalid constant");
+			return err;
+		}
+		b += len;
+		total_len -= len;
+	}
+
+	// the decompilers don't use the line table, skip it
+	ERR_FAIL_COND_V((int64_t)line_count * 8 > total_len, ERR_INVALID_DATA);
+	b += line_count * 8;
+	total_len -= line_count * 8;
+
+	tokens.resize(token_count);
+	uint32_t *tw = tokens.ptrw();
+	for (int i = 0; i < token_count; i++) {
+		ERR_FAIL_COND_V(total_len < 1, ERR_INVALID_DATA);
+
+		if ((*b) & TOKEN_BYTE_MASK) { //little endian always
+			ERR_FAIL_COND_V(total_len < 4, ERR_INVALID_DATA);
+
+			tw[i] = decode_uint32(b) & ~TOKEN_BYTE_MASK;
+			b += 4;
+			total_len -= 4;
+		} else {
+			tw[i] = *b;
+			b += 1;
+			total_len--;
+		}
+	}
+	return OK;
+}
+
+String GDSCTokenStream::get_identifier(int p_idx) const {
+	ERR_FAIL_INDEX_V(p_idx, (int)identifier_spans.size(), String());
+	const IdentifierSpan &span = identifier_spans[p_idx];
+	if (span.length == 0) {
+		return String();
+	}
+	const uint8_t *src = buffer.ptr() + span.offset;
+	// The last byte is the null terminator
+	int len = span.length - 1;
+	LocalVector<char> cs;
+	cs.resize(len + 1);
+	for (int j = 0; j < len; j++) {
+		cs[j] = src[j] ^ IDENTIFIER_XOR_KEY;
+	}
+	cs[len] = 0;
+	String s;
+	s.parse_utf8(cs.ptr());
+	return s;
+}
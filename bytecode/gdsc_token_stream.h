@@ -0,0 +1,49 @@
+/*************************************************************************/
+/*  gdsc_token_stream.h                                                  */
+/*************************************************************************/
+
+#ifndef GDSC_TOKEN_STREAM_H
+#define GDSC_TOKEN_STREAM_H
+
+#include "core/templates/local_vector.h"
+#include "core/templates/vector.h"
+#include "core/variant/variant.h"
+
+// Parses the header (identifiers, constants and tokens) of a compiled GDScript (GDSC) buffer.
+// The buffer is referenced, not copied, and identifiers are decoded from it every time they are requested, so a
+// parsed stream is never written to and can be read from several threads at once.
+// The header layout is the same for every bytecode revision, so this is shared by all of the decompilers.
+class GDSCTokenStream {
+	struct IdentifierSpan {
+		int offset;
+		int length;
+	};
+
+	enum {
+		TOKEN_BYTE_MASK = 0x80,
+		IDENTIFIER_XOR_KEY = 0xb6,
+		HEADER_SIZE = 24,
+	};
+
+	Vector<uint8_t> buffer;
+	int bytecode_version = 0;
+	LocalVector<IdentifierSpan> identifier_spans;
+	Vector<Variant> constants;
+	Vector<uint32_t> tokens;
+	String error_message;
+
+public:
+	Error parse(const Vector<uint8_t> &p_buffer, int p_max_bytecode_version, int p_variant_ver_major);
+	void clear();
+
+	int get_bytecode_version() const { return bytecode_version; }
+	int get_identifier_count() const { return identifier_spans.size(); }
+	String get_identifier(int p_idx) const;
+	int get_constant_count() const { return constants.size(); }
+	const Vector<Variant> &get_constants() const { return constants; }
+	int get_token_count() const { return tokens.size(); }
+	const Vector<uint32_t> &get_tokens() const { return tokens; }
+	String get_error_message() const { return error_message; }
+};
+
+#endif // GDSC_TOKEN_STREAM_H
@@ -27,11 +27,13 @@ Ref<Image> ImageParserV2::convert_indexed_image(const Vector<uint8_t> &p_imgdata
 	if (p_format == V2Image::IMAGE_FORMAT_INTENSITY) {
 		r_format = Image::FORMAT_RGBA8;
 		r_imgdata.resize(datalen * 4);
+		const uint8_t *src = p_imgdata.ptr();
+		uint8_t *dst = r_imgdata.ptrw();
 		for (int i = 0; i < datalen; i++) {
-			r_imgdata.write[i * 4] = 255;
-			r_imgdata.write[i * 4 + 1] = 255;
-			r_imgdata.write[i * 4 + 2] = 255;
-			r_imgdata.write[i * 4 + 3] = p_imgdata[i];
+			dst[i * 4] = 255;
+			dst[i * 4 + 1] = 255;
+			dst[i * 4 + 2] = 255;
+			dst[i * 4 + 3] = src[i];
 		}
 	} else {
 		int pal_width;
@@ -42,16 +44,37 @@ Ref<Image> ImageParserV2::convert_indexed_image(const Vector<uint8_t> &p_imgdata
 			r_format = Image::FORMAT_RGBA8;
 			pal_width = 4;
 		}
-
-		Vector<Vector<uint8_t>> palette;
+		const int pixel_count = p_width * p_height;
+		if (pixel_count > datalen) {
+			if (r_error) {
+				*r_error = ERR_FILE_CORRUPT;
+			}
+			ERR_FAIL_V_MSG(Ref<Image>(), "Indexed image data is truncated");
+		}
 
 		// palette data starts at end of pixel data, is equal to 256 * pal_width
-		for (int dataidx = p_width * p_height; dataidx < p_imgdata.size(); dataidx += pal_width) {
-			palette.push_back(p_imgdata.slice(dataidx, dataidx + pal_width));
+		// entries are padded to 4 bytes so every lookup is a fixed size copy; missing entries stay black
+		uint8_t palette[256 * 4] = {};
+		const uint8_t *src = p_imgdata.ptr();
+		const int pal_count = MIN((datalen - pixel_count) / pal_width, 256);
+		for (int i = 0; i < pal_count; i++) {
+			memcpy(&palette[i * 4], &src[pixel_count + i * pal_width], pal_width);
 		}
+
 		// pixel data is index into palette
-		for (int i = 0; i < p_width * p_height; i++) {
-			r_imgdata.append_array(palette[p_imgdata[i]]);
+		r_imgdata.resize(pixel_count * pal_width);
+		uint8_t *dst = r_imgdata.ptrw();
+		if (pal_width == 4) {
+			for (int i = 0; i < pixel_count; i++) {
+				memcpy(&dst[i * 4], &palette[src[i] * 4], 4);
+			}
+		} else {
+			for (int i = 0; i < pixel_count; i++) {
+				const uint8_t *entry = &palette[src[i] * 4];
+				dst[i * 3] = entry[0];
+				dst[i * 3 + 1] = entry[1];
+				dst[i * 3 + 2] = entry[2];
+			}
 		}
 	}
 	Ref<Image> img = Image::create_from_data(p_width, p_height, p_mipmaps > 0, r_format, r_imgdata);
@@ -172,7 +195,7 @@ Error ImageParserV2::decode_image_v2(Ref<FileAccess> f, Variant &r_v, bool conve
 		if (convert_indexed && (old_format == 5 || old_format == 6 || old_format == 1)) {
 			Error err;
 			img = ImageParserV2::convert_indexed_image(imgdata, width, height, mipmaps, (V2Image::Format)old_format, &err);
-			ERR_FAIL_COND_V_MSG(err, err,
+			ERR_FAIL_COND_V_MSG(err || img.is_null(), err ? err : ERR_PARSE_ERROR,
 					"Can't convert deprecated image format " + ImageEnumCompat::get_v2_format_name((V2Image::Format)old_format) + " to new image formats!");
 		} else {
 			// We wait until we've skipped all the data to do this
@@ -285,9 +308,9 @@ Error ImageParserV2::parse_image_construct_v2(VariantParser::Stream *p_stream, V
 	if (convert_indexed && (old_format == 5 || old_format == 6 || old_format == 1)) {
 		Error err;
 		img = ImageParserV2::convert_indexed_image(data, width, height, mipmaps, (V2Image::Format)old_format, &err);
-		if (img->is_empty()) {
+		if (err || img.is_null() || img->is_empty()) {
 			r_err_str = "Failed to convert deprecated image format " + ImageEnumCompat::get_v2_format_name((V2Image::Format)old_format) + " to new image format!";
-			return err;
+			return err ? err : ERR_PARSE_ERROR;
 		}
 	} else {
 		if (fmt == Image::FORMAT_MAX) {
@@ -296,7 +319,7 @@ Error ImageParserV2::parse_image_construct_v2(VariantParser::Stream *p_stream, V
 		}
 		img = Image::create_from_data(width, height, mipmaps > 0, fmt, data);
 	}
-	if (img->is_empty()) {
+	if (img.is_null() || img->is_empty()) {
 		r_err_str = "Failed to create image";
 		return ERR_PARSE_ERROR;
 	}
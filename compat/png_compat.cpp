@@ -0,0 +1,87 @@
+#include "png_compat.h"
+#include <png.h>
+
+namespace PNGCompat {
+// Starts reading a buffer written by Image::png_packer ("PNG " followed by the file) and works out the format
+// Image::png_unpacker would decode it to. On success the caller has to finish reading or free r_png_img.
+static Error _png_begin_read(const Vector<uint8_t> &p_buffer, png_image &r_png_img, Image::Format &r_format) {
+	int size = p_buffer.size() - 4;
+	ERR_FAIL_COND_V(size <= 0, ERR_FILE_CORRUPT);
+	const uint8_t *r = p_buffer.ptr();
+
+	ERR_FAIL_COND_V(r[0] != 'P' || r[1] != 'N' || r[2] != 'G' || r[3] != ' ', ERR_FILE_CORRUPT);
+	memset(&r_png_img, 0, sizeof(r_png_img));
+	r_png_img.version = PNG_IMAGE_VERSION;
+	if (!png_image_begin_read_from_memory(&r_png_img, &r[4], size)) {
+		ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, "Error unpacking PNG image: " + String(r_png_img.message));
+	}
+	// same conversions as the engine's PNG loader: RGBA component order, 8 bit components, no palette,
+	// and 16 bit images without color space chunks are treated as sRGB
+	r_png_img.format &= ~(PNG_FORMAT_FLAG_BGR | PNG_FORMAT_FLAG_AFIRST | PNG_FORMAT_FLAG_LINEAR | PNG_FORMAT_FLAG_COLORMAP);
+	r_png_img.flags |= PNG_IMAGE_FLAG_16BIT_sRGB;
+	switch (r_png_img.format) {
+		case PNG_FORMAT_GRAY:
+			r_format = Image::FORMAT_L8;
+			break;
+		case PNG_FORMAT_GA:
+			r_format = Image::FORMAT_LA8;
+			break;
+		case PNG_FORMAT_RGB:
+			r_format = Image::FORMAT_RGB8;
+			break;
+		case PNG_FORMAT_RGBA:
+			r_format = Image::FORMAT_RGBA8;
+			break;
+		default:
+			png_image_free(&r_png_img);
+			ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "Unsupported PNG format.");
+	}
+	return OK;
+}
+
+// Reads the dimensions and the format Image::png_unpacker would decode to, without decoding
+Error png_get_info(const Vector<uint8_t> &p_buffer, int &r_width, int &r_height, Image::Format &r_format) {
+	png_image png_img;
+	Error err = _png_begin_read(p_buffer, png_img, r_format);
+	if (err != OK) {
+		return err;
+	}
+	r_width = png_img.width;
+	r_height = png_img.height;
+	png_image_free(&png_img);
+	return OK;
+}
+
+// Decodes into a caller-owned buffer, which must hold exactly width * height pixels of p_format.
+// Images stored in another format are decoded and then converted with Image::convert, as the engine would.
+Error png_unpack_into(const Vector<uint8_t> &p_buffer, Image::Format p_format, uint8_t *r_dst, int p_dst_size) {
+	png_image png_img;
+	Image::Format format;
+	Error err = _png_begin_read(p_buffer, png_img, format);
+	if (err != OK) {
+		return err;
+	}
+	if (format != p_format) {
+		png_image_free(&png_img);
+		Ref<Image> img = Image::png_unpacker(p_buffer);
+		ERR_FAIL_COND_V_MSG(img.is_null() || img->is_empty(), ERR_FILE_CORRUPT, "Failed decoding PNG image.");
+		img->convert(p_format);
+		const Vector<uint8_t> data = img->get_data();
+		ERR_FAIL_COND_V(data.size() != p_dst_size, ERR_INVALID_PARAMETER);
+		memcpy(r_dst, data.ptr(), p_dst_size);
+		return OK;
+	}
+
+	const png_uint_32 stride = PNG_IMAGE_ROW_STRIDE(png_img);
+	if (PNG_IMAGE_BUFFER_SIZE(png_img, stride) != (png_uint_32)p_dst_size) {
+		png_image_free(&png_img);
+		ERR_FAIL_V(ERR_INVALID_PARAMETER);
+	}
+	// png_image_finish_read() frees png_img whether or not it succeeds
+	if (!png_image_finish_read(&png_img, nullptr, r_dst, stride, nullptr)) {
+		ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, "Failed decoding PNG image: " + String(png_img.message));
+	}
+	return OK;
+}
+
+} //namespace PNGCompat
@@ -0,0 +1,10 @@
+#ifndef PNG_COMPAT_H
+#define PNG_COMPAT_H
+
+#include "core/io/image.h"
+
+namespace PNGCompat {
+Error png_get_info(const Vector<uint8_t> &p_buffer, int &r_width, int &r_height, Image::Format &r_format);
+Error png_unpack_into(const Vector<uint8_t> &p_buffer, Image::Format p_format, uint8_t *r_dst, int p_dst_size);
+}
+#endif //PNG_COMPAT_H
@@ -48,9 +48,10 @@ Error ResourceFormatLoaderCompat::convert_bin_to_txt(const String &p_path, const
 
 	ResourceLoaderCompat *loader = _open_bin(p_path, output_dir, true, &error, r_progress);
 	ERR_RFLBC_COND_V_MSG_CLEANUP(error != OK, error, "Cannot open resource '" + p_path + "'.", loader);
-	// TODO: We need to rewrite ResourceLoaderCompat to allow the use of Double RealT dynamically
-	// Right now, just fail
-	ERR_RFLBC_COND_V_MSG_CLEANUP(loader->using_real_t_double, ERR_UNAVAILABLE, "Double RealT is not supported in ResourceFormatLoaderCompat.", loader);
+	// parse_variant() converts double precision reals to our real_t, so they only lose precision on float builds
+	if (loader->using_real_t_double && sizeof(real_t) == 4) {
+		WARN_PRINT("Resource '" + p_path + "' was saved with double precision reals, they will be written with single precision.");
+	}
 
 	error = loader->load();
 	ERR_RFLBC_COND_V_MSG_CLEANUP(error != OK, error, "Cannot load resource '" + p_path + "'.", loader);
@@ -473,7 +474,7 @@ Error ResourceLoaderCompat::open_bin(Ref<FileAccess> p_f, bool p_no_resources, b
 			// 	}
 			// }
 		}
-		external_resources.push_back(er);
+		_add_external_resource(er);
 	}
 
 	print_bl("ext resources: " + itos(ext_resources_size));
@@ -483,6 +484,7 @@ Error ResourceLoaderCompat::open_bin(Ref<FileAccess> p_f, bool p_no_resources, b
 		IntResource ir;
 		ir.path = get_unicode_string();
 		ir.offset = f->get_64();
+		// paths are only final once load() resolves them, so they are indexed there
 		internal_resources.push_back(ir);
 	}
 
@@ -544,6 +546,17 @@ Error ResourceLoaderCompat::load_ext_resource(const uint32_t i) {
 	return OK;
 }
 
+void ResourceLoaderCompat::_add_external_resource(const ExtResource &er) {
+	int idx = external_resources.size();
+	external_resources.push_back(er);
+	if (!external_path_index.has(er.path)) {
+		external_path_index.insert(er.path, idx);
+	}
+	if (!er.id.is_empty() && !external_id_index.has(er.id)) {
+		external_id_index.insert(er.id, idx);
+	}
+}
+
 Ref<Resource> ResourceLoaderCompat::get_external_resource(const int subindex) {
 	if (external_resources[subindex - 1].cache.is_valid()) {
 		return external_resources[subindex - 1].cache;
@@ -562,19 +575,17 @@ String ResourceLoaderCompat::get_external_resource_path(const Ref<Resource> &res
 }
 
 int ResourceLoaderCompat::get_external_resource_save_order_by_path(const String &path) {
-	for (int i = 0; i < external_resources.size(); i++) {
-		if (external_resources[i].path == path) {
-			return external_resources[i].save_order;
-		}
+	const int *idx = external_path_index.getptr(path);
+	if (idx) {
+		return external_resources[*idx].save_order;
 	}
 	return -1;
 }
 
 Ref<Resource> ResourceLoaderCompat::get_external_resource(const String &path) {
-	for (int i = 0; i < external_resources.size(); i++) {
-		if (external_resources[i].path == path) {
-			return external_resources[i].cache;
-		}
+	const int *idx = external_path_index.getptr(path);
+	if (idx) {
+		return external_resources[*idx].cache;
 	}
 	// We don't do multithreading, so if this external resource is not cached (either dummy or real)
 	// then we return a blank resource
@@ -582,10 +593,9 @@ Ref<Resource> ResourceLoaderCompat::get_external_resource(const String &path) {
 }
 
 Ref<Resource> ResourceLoaderCompat::get_external_resource_by_id(const String &id) {
-	for (int i = 0; i < external_resources.size(); i++) {
-		if (external_resources[i].id == id) {
-			return external_resources[i].cache;
-		}
+	const int *idx = external_id_index.getptr(id);
+	if (idx) {
+		return external_resources[*idx].cache;
 	}
 	return Ref<Resource>();
 }
@@ -600,12 +610,7 @@ bool ResourceLoaderCompat::has_external_resource(const Ref<Resource> &res) {
 }
 
 bool ResourceLoaderCompat::has_external_resource(const String &path) {
-	for (int i = 0; i < external_resources.size(); i++) {
-		if (external_resources[i].path == path) {
-			return true;
-		}
-	}
-	return false;
+	return external_path_index.has(path);
 }
 
 // by default, we don't instance an internal resource.
@@ -656,30 +661,60 @@ Ref<Resource> ResourceLoaderCompat::instance_internal_resource(const String &pat
 	return res;
 }
 
-String ResourceLoaderCompat::get_internal_resource_path(const Ref<Resource> &res) {
-	for (KeyValue<String, Ref<Resource>> E : internal_res_cache) {
-		if (E.value == res) {
-			return E.key;
+void ResourceLoaderCompat::_add_internal_resource(const IntResource &ir) {
+	internal_resources.push_back(ir);
+	_set_internal_resource_path(internal_resources.size() - 1, ir.path);
+}
+
+void ResourceLoaderCompat::_set_internal_resource_path(int p_index, const String &p_path) {
+	internal_resources.write[p_index].path = p_path;
+	if (!internal_path_index.has(p_path)) {
+		internal_path_index.insert(p_path, p_index);
+	}
+}
+
+void ResourceLoaderCompat::_cache_internal_resource(const String &path, const Ref<Resource> &res) {
+	Ref<Resource> *existing = internal_res_cache.getptr(path);
+	if (existing) {
+		if (existing->is_valid()) {
+			internal_res_paths.erase(existing->ptr());
+		}
+		*existing = res;
+	} else {
+		internal_res_cache.insert(path, res);
+	}
+	if (res.is_valid()) {
+		if (!internal_res_paths.has(res.ptr())) {
+			internal_res_paths.insert(res.ptr(), path);
+		}
+		String id = res->get_scene_unique_id();
+		if (!id.is_empty() && !internal_res_by_id.has(id)) {
+			internal_res_by_id.insert(id, res);
 		}
 	}
+}
+
+String ResourceLoaderCompat::get_internal_resource_path(const Ref<Resource> &res) {
+	const String *path = res.is_valid() ? internal_res_paths.getptr(res.ptr()) : nullptr;
+	if (path) {
+		return *path;
+	}
 	return String();
 }
 
 Ref<Resource> ResourceLoaderCompat::get_internal_resource_by_subindex(const int subindex) {
-	for (auto R = internal_res_cache.front(); R; R = R->next()) {
-		if (R->value()->get_scene_unique_id() == itos(subindex)) {
-			return R->value();
-		}
+	const Ref<Resource> *res = internal_res_by_id.getptr(itos(subindex));
+	if (res) {
+		return *res;
 	}
 	return Ref<Resource>();
 }
 
 int ResourceLoaderCompat::get_internal_resource_save_order_by_path(const String &path) {
 	if (has_internal_resource(path)) {
-		for (int i = 0; i < internal_resources.size(); i++) {
-			if (internal_resources[i].path == path) {
-				return internal_resources[i].save_order;
-			}
+		const int *idx = internal_path_index.getptr(path);
+		if (idx) {
+			return internal_resources[*idx].save_order;
 		}
 	}
 	return -1;
@@ -707,12 +742,7 @@ List<ResourceProperty> ResourceLoaderCompat::get_internal_resource_properties(co
 }
 
 bool ResourceLoaderCompat::has_internal_resource(const Ref<Resource> &res) {
-	for (KeyValue<String, Ref<Resource>> E : internal_res_cache) {
-		if (E.value == res) {
-			return true;
-		}
-	}
-	return false;
+	return res.is_valid() && internal_res_paths.has(res.ptr());
 }
 
 bool ResourceLoaderCompat::has_internal_resource(const String &path) {
@@ -949,7 +979,7 @@ Error ResourceLoaderCompat::load() {
 		} else {
 			path = local_path;
 		}
-		internal_resources.write[i].path = path;
+		_set_internal_resource_path(i, path);
 
 		uint64_t offset = internal_resources[i].offset;
 		f->seek(offset);
@@ -1019,7 +1049,7 @@ Error ResourceLoaderCompat::load() {
 		// We keep a list of the properties loaded (which are only variants) in case of a fake load
 		internal_index_cached_properties[path] = lrp;
 		// If fake_load, this is a FakeResource
-		internal_res_cache[path] = res;
+		_cache_internal_resource(path, res);
 
 		// packed scenes with instances for nodes won't work right without creating an instance of it
 		// So we always instance them regardless if this is a fake load or not.
@@ -1126,7 +1156,7 @@ Ref<Resource> ResourceLoaderCompat::set_dummy_ext(const String &path, const Stri
 	er.path = path;
 	er.type = exttype;
 	er.cache = make_dummy(path, exttype, itos(external_resources.size() + 1));
-	external_resources.push_back(er);
+	_add_external_resource(er);
 
 	return er.cache;
 }
@@ -1184,6 +1214,8 @@ Error ResourceLoaderCompat::save_as_text_unloaded(const String &dest_path, uint3
 	Error err;
 	Ref<FileAccess> wf = FileAccess::open(dest_path, FileAccess::WRITE, &err);
 	ERR_FAIL_COND_V_MSG(err != OK, ERR_CANT_OPEN, "Cannot save file '" + dest_path + "'.");
+	// everything goes through the buffered writer; variants are written straight into it
+	TextFileWriterCompat w(wf);
 
 	String main_res_path = get_resource_path(res);
 	if (main_res_path == "") {
@@ -1227,8 +1259,8 @@ Error ResourceLoaderCompat::save_as_text_unloaded(const String &dest_path, uint3
 				title += " uid=\"" + ResourceUID::get_singleton()->id_to_text(res_uid) + "\"";
 			}
 		}
-		wf->store_string(title);
-		wf->store_line("]\n"); // one empty line
+		w.store_string(title);
+		w.store_line("]\n"); // one empty line
 	}
 
 	for (int i = 0; i < external_resources.size(); i++) {
@@ -1247,17 +1279,17 @@ Error ResourceLoaderCompat::save_as_text_unloaded(const String &dest_path, uint3
 			}
 			// id is a string in Godot 4.x
 			s += " path=\"" + p + "\" id=\"" + itos(i + 1) + "\"]\n";
-			wf->store_string(s); // Bundled.
+			w.store_string(s); // Bundled.
 
 			// Godot 3.x (and below)
 		} else {
-			wf->store_string("[ext_resource path=\"" + p + "\" type=\"" + external_resources[i].type +
+			w.store_string("[ext_resource path=\"" + p + "\" type=\"" + external_resources[i].type +
 					"\" id=" + itos(i + 1) + "]\n"); // bundled
 		}
 	}
 
 	if (external_resources.size()) {
-		wf->store_line(String()); // separate
+		w.store_line(String()); // separate
 	}
 	RBSet<String> used_unique_ids;
 	// // Godot 4.x: Get all the unique ids for lookup
@@ -1286,7 +1318,7 @@ Error ResourceLoaderCompat::save_as_text_unloaded(const String &dest_path, uint3
 		}
 
 		if (main) {
-			wf->store_line("[resource]");
+			w.store_line("[resource]");
 		} else {
 			String line = "[sub_resource ";
 			String type = get_internal_resource_type(path);
@@ -1321,19 +1353,19 @@ Error ResourceLoaderCompat::save_as_text_unloaded(const String &dest_path, uint3
 				// Godot 2.x quirk: newline between subresource and properties
 				line += "\n";
 			}
-			wf->store_line(line);
+			w.store_line(line);
 		}
 
 		List<ResourceProperty> properties = internal_index_cached_properties[path];
 		for (List<ResourceProperty>::Element *PE = properties.front(); PE; PE = PE->next()) {
 			ResourceProperty pe = PE->get();
-			String vars;
-			VariantWriterCompat::write_to_string(pe.value, vars, engine_ver_major, _write_rlc_resources, this);
-			wf->store_string(pe.name.property_name_encode() + " = " + vars + "\n");
+			w.store_string(pe.name.property_name_encode() + " = ");
+			VariantWriterCompat::write_compat(pe.value, engine_ver_major, TextFileWriterCompat::store_string_func, &w, _write_rlc_resources, this, false);
+			w.store_ascii("\n", 1);
 		}
 
 		if (i < internal_resources.size() - 1) {
-			wf->store_line(String());
+			w.store_line(String());
 		}
 	}
 
@@ -1382,44 +1414,39 @@ Error ResourceLoaderCompat::save_as_text_unloaded(const String &dest_path, uint3
 				header += sgroups;
 			}
 
-			wf->store_string(header);
+			w.store_string(header);
 
 			if (instance_placeholder != String()) {
-				String vars;
-				wf->store_string(" instance_placeholder=");
-				VariantWriterCompat::write_to_string(instance_placeholder, vars, engine_ver_major, _write_rlc_resources, this);
-				wf->store_string(vars);
+				w.store_string(" instance_placeholder=");
+				VariantWriterCompat::write_compat(instance_placeholder, engine_ver_major, TextFileWriterCompat::store_string_func, &w, _write_rlc_resources, this, false);
 			}
 
 			if (instance.is_valid()) {
-				String vars;
-				wf->store_string(" instance=");
-				VariantWriterCompat::write_to_string(instance, vars, engine_ver_major, _write_rlc_resources, this);
-				wf->store_string(vars);
+				w.store_string(" instance=");
+				VariantWriterCompat::write_compat(instance, engine_ver_major, TextFileWriterCompat::store_string_func, &w, _write_rlc_resources, this, false);
 			}
 
-			wf->store_line("]");
+			w.store_line("]");
 			if (ver_format_text == 1 && state->get_node_property_count(i) != 0) {
 				// Godot 2.x quirk: newline between header and properties
 				// We're emulating these whitespace quirks to enable easy diffs for regression testing
-				wf->store_line("");
+				w.store_line("");
 			}
 
 			for (int j = 0; j < state->get_node_property_count(i); j++) {
-				String vars;
-				VariantWriterCompat::write_to_string(state->get_node_property_value(i, j), vars, engine_ver_major, _write_rlc_resources, this);
-
-				wf->store_string(String(state->get_node_property_name(i, j)).property_name_encode() + " = " + vars + "\n");
+				w.store_string(String(state->get_node_property_name(i, j)).property_name_encode() + " = ");
+				VariantWriterCompat::write_compat(state->get_node_property_value(i, j), engine_ver_major, TextFileWriterCompat::store_string_func, &w, _write_rlc_resources, this, false);
+				w.store_ascii("\n", 1);
 			}
 
 			if (i < state->get_node_count() - 1) {
-				wf->store_line(String());
+				w.store_line(String());
 			}
 		}
 
 		for (int i = 0; i < state->get_connection_count(); i++) {
 			if (i == 0) {
-				wf->store_line("");
+				w.store_line("");
 			}
 
 			String connstr = "[connection";
@@ -1433,28 +1460,28 @@ Error ResourceLoaderCompat::save_as_text_unloaded(const String &dest_path, uint3
 			}
 
 			Array binds = state->get_connection_binds(i);
-			wf->store_string(connstr);
+			w.store_string(connstr);
 			if (binds.size()) {
-				String vars;
-				VariantWriterCompat::write_to_string(binds, vars, engine_ver_major, _write_rlc_resources, this);
-				wf->store_string(" binds= " + vars);
+				w.store_string(" binds= ");
+				VariantWriterCompat::write_compat(binds, engine_ver_major, TextFileWriterCompat::store_string_func, &w, _write_rlc_resources, this, false);
 			}
 
-			wf->store_line("]");
+			w.store_line("]");
 			if (ver_format_text == 1) {
 				// Godot 2.x has this particular quirk, don't know why
-				wf->store_line("");
+				w.store_line("");
 			}
 		}
 
 		Vector<NodePath> editable_instances = state->get_editable_instances();
 		for (int i = 0; i < editable_instances.size(); i++) {
 			if (i == 0) {
-				wf->store_line("");
+				w.store_line("");
 			}
-			wf->store_line("[editable path=\"" + editable_instances[i].operator String() + "\"]");
+			w.store_line("[editable path=\"" + editable_instances[i].operator String() + "\"]");
 		}
 	}
+	w.flush();
 	wf->flush();
 	if (wf->get_error() != OK && wf->get_error() != ERR_FILE_EOF) {
 		return ERR_CANT_CREATE;
@@ -1463,8 +1490,69 @@ Error ResourceLoaderCompat::save_as_text_unloaded(const String &dest_path, uint3
 	return OK;
 }
 
+// Packed arrays are stored as one contiguous block, so they are read with a single get_buffer()
+// and only byte-swapped afterwards if the file's endianness differs from ours.
+static void _swap_buffer_32(uint32_t *p_ptr, uint64_t p_count) {
+	for (uint64_t i = 0; i < p_count; i++) {
+		p_ptr[i] = BSWAP32(p_ptr[i]);
+	}
+}
+
+static void _swap_buffer_64(uint64_t *p_ptr, uint64_t p_count) {
+	for (uint64_t i = 0; i < p_count; i++) {
+		p_ptr[i] = BSWAP64(p_ptr[i]);
+	}
+}
+
+static void _read_buffer_32(Ref<FileAccess> &f, void *r_dst, uint64_t p_count, bool p_swap) {
+	f->get_buffer((uint8_t *)r_dst, p_count * 4);
+	if (p_swap) {
+		_swap_buffer_32((uint32_t *)r_dst, p_count);
+	}
+}
+
+static void _read_buffer_64(Ref<FileAccess> &f, void *r_dst, uint64_t p_count, bool p_swap) {
+	f->get_buffer((uint8_t *)r_dst, p_count * 8);
+	if (p_swap) {
+		_swap_buffer_64((uint64_t *)r_dst, p_count);
+	}
+}
+
+// Reals are stored as doubles if the resource was saved with FORMAT_FLAG_REAL_T_IS_DOUBLE;
+// if that doesn't match our real_t, the block is read as-is and converted in one pass.
+static void _read_reals(Ref<FileAccess> &f, real_t *r_dst, uint64_t p_count, bool p_swap) {
+	if (f->real_is_double == (sizeof(real_t) == 8)) {
+		if (sizeof(real_t) == 8) {
+			_read_buffer_64(f, r_dst, p_count, p_swap);
+		} else {
+			_read_buffer_32(f, r_dst, p_count, p_swap);
+		}
+	} else if (f->real_is_double) {
+		Vector<double> tmp;
+		tmp.resize(p_count);
+		double *src = tmp.ptrw();
+		_read_buffer_64(f, src, p_count, p_swap);
+		for (uint64_t i = 0; i < p_count; i++) {
+			r_dst[i] = (real_t)src[i];
+		}
+	} else {
+		Vector<float> tmp;
+		tmp.resize(p_count);
+		float *src = tmp.ptrw();
+		_read_buffer_32(f, src, p_count, p_swap);
+		for (uint64_t i = 0; i < p_count; i++) {
+			r_dst[i] = (real_t)src[i];
+		}
+	}
+}
+
 Error ResourceLoaderCompat::parse_variant(Variant &r_v) {
 	uint32_t type = f->get_32();
+#ifdef BIG_ENDIAN_ENABLED
+	const bool swap_endian = !stored_big_endian;
+#else
+	const bool swap_endian = stored_big_endian;
+#endif
 	//print_bl("find property of type: %d", type);
 
 	switch (type) {
@@ -1818,16 +1906,7 @@ Error ResourceLoaderCompat::parse_variant(Variant &r_v) {
 				break;
 			}
 			int32_t *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(int32_t));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint32_t *ptr = (uint32_t *)w.ptr();
-				for (int i = 0; i < len; i++) {
-					ptr[i] = BSWAP32(ptr[i]);
-				}
-			}
-
-#endif
+			_read_buffer_32(f, w, len, swap_endian);
 
 			r_v = array;
 		} break;
@@ -1841,16 +1920,7 @@ Error ResourceLoaderCompat::parse_variant(Variant &r_v) {
 				break;
 			}
 			int64_t *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(int64_t));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint64_t *ptr = (uint64_t *)w.ptr();
-				for (int i = 0; i < len; i++) {
-					ptr[i] = BSWAP64(ptr[i]);
-				}
-			}
-
-#endif
+			_read_buffer_64(f, w, len, swap_endian);
 
 			r_v = array;
 		} break;
@@ -1865,16 +1935,7 @@ Error ResourceLoaderCompat::parse_variant(Variant &r_v) {
 			}
 			float *w = array.ptrw();
 
-			f->get_buffer((uint8_t *)w, len * sizeof(float));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint32_t *ptr = (uint32_t *)w.ptr();
-				for (int i = 0; i < len; i++) {
-					ptr[i] = BSWAP32(ptr[i]);
-				}
-			}
-
-#endif
+			_read_buffer_32(f, w, len, swap_endian);
 
 			r_v = array;
 		} break;
@@ -1889,16 +1950,7 @@ Error ResourceLoaderCompat::parse_variant(Variant &r_v) {
 			}
 
 			double *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(double));
-#ifdef BIG_ENDIAN_ENABLED
-			{
-				uint64_t *ptr = (uint64_t *)w.ptr();
-				for (int i = 0; i < len; i++) {
-					ptr[i] = BSWAP64(ptr[i]);
-				}
-			}
-
-#endif
+			_read_buffer_64(f, w, len, swap_endian);
 
 			r_v = array;
 		} break;
@@ -1920,21 +1972,7 @@ Error ResourceLoaderCompat::parse_variant(Variant &r_v) {
 			Vector<Vector2> array;
 			array.resize(len);
 			Vector2 *w = array.ptrw();
-			if (sizeof(Vector2) == 8) {
-				f->get_buffer((uint8_t *)w, len * sizeof(real_t) * 2);
-#ifdef BIG_ENDIAN_ENABLED
-				{
-					uint32_t *ptr = (uint32_t *)w.ptr();
-					for (int i = 0; i < len * 2; i++) {
-						ptr[i] = BSWAP32(ptr[i]);
-					}
-				}
-
-#endif
-
-			} else {
-				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, "Vector2 size is NOT 8!");
-			}
+			_read_reals(f, (real_t *)w, len * 2, swap_endian);
 
 			r_v = array;
 
@@ -1945,21 +1983,7 @@ Error ResourceLoaderCompat::parse_variant(Variant &r_v) {
 			Vector<Vector3> array;
 			array.resize(len);
 			Vector3 *w = array.ptrw();
-			if (sizeof(Vector3) == 12) {
-				f->get_buffer((uint8_t *)w, len * sizeof(real_t) * 3);
-#ifdef BIG_ENDIAN_ENABLED
-				{
-					uint32_t *ptr = (uint32_t *)w.ptr();
-					for (int i = 0; i < len * 3; i++) {
-						ptr[i] = BSWAP32(ptr[i]);
-					}
-				}
-
-#endif
-
-			} else {
-				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, "Vector3 size is NOT 12!");
-			}
+			_read_reals(f, (real_t *)w, len * 3, swap_endian);
 
 			r_v = array;
 
@@ -1970,21 +1994,8 @@ Error ResourceLoaderCompat::parse_variant(Variant &r_v) {
 			Vector<Color> array;
 			array.resize(len);
 			Color *w = array.ptrw();
-			if (sizeof(Color) == 16) {
-				f->get_buffer((uint8_t *)w, len * sizeof(real_t) * 4);
-#ifdef BIG_ENDIAN_ENABLED
-				{
-					uint32_t *ptr = (uint32_t *)w.ptr();
-					for (int i = 0; i < len * 4; i++) {
-						ptr[i] = BSWAP32(ptr[i]);
-					}
-				}
-
-#endif
-
-			} else {
-				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, "Color size is NOT 16!");
-			}
+			// Color components are always stored as 32-bit floats
+			_read_buffer_32(f, w, len * 4, swap_endian);
 
 			r_v = array;
 		} break;
@@ -3146,7 +3157,7 @@ Error ResourceLoaderCompat::fake_load_text() {
 			String uidt = next_tag.fields["uid"];
 			er.uid = ResourceUID::get_singleton()->text_to_id(uidt);
 		}
-		external_resources.push_back(er);
+		_add_external_resource(er);
 		error = load_ext_resource(external_resources.size() - 1);
 		if (error) {
 			_printerr();
@@ -3199,9 +3210,9 @@ Error ResourceLoaderCompat::fake_load_text() {
 			ir.path = local_path;
 		}
 		ir.offset = 0;
-		internal_resources.push_back(ir);
+		_add_internal_resource(ir);
 		internal_type_cache[ir.path] = type;
-		internal_res_cache[ir.path] = instance_internal_resource(ir.path, type, id);
+		_cache_internal_resource(ir.path, instance_internal_resource(ir.path, type, id));
 		if (main_res) {
 			resource = internal_res_cache[ir.path];
 		}
@@ -3269,12 +3280,12 @@ Error ResourceLoaderCompat::fake_load_text() {
 		ir.path = "local://" + id;
 		local_path = ir.path;
 		ir.offset = 0;
-		internal_resources.push_back(ir);
+		_add_internal_resource(ir);
 		internal_type_cache[ir.path] = "PackedScene";
 		((Ref<FakeResource>)packed_scene)->set_real_path(local_path);
 		((Ref<FakeResource>)packed_scene)->set_real_type("PackedScene");
 
-		internal_res_cache[ir.path] = packed_scene;
+		_cache_internal_resource(ir.path, packed_scene);
 		// Right now, we're just handling converting back to bin, so clear lrp and store "_bundled";
 		lrp.clear();
 		ResourceProperty embed;
@@ -9,6 +9,7 @@
 #include "core/io/resource.h"
 #include "core/io/resource_format_binary.h"
 #include "core/object/script_language.h"
+#include "core/templates/hash_map.h"
 #include "core/variant/variant.h"
 #include "scene/resources/packed_scene.h"
 
@@ -245,6 +246,12 @@ protected:
 	RBMap<String, Ref<Resource>> internal_res_cache;
 	RBMap<String, String> internal_type_cache;
 	RBMap<String, List<ResourceProperty>> internal_index_cached_properties;
+	// lookup indexes for the above; for duplicate paths/ids the first resource added wins, like the linear scans did
+	HashMap<String, int> external_path_index;
+	HashMap<String, int> external_id_index;
+	HashMap<String, int> internal_path_index;
+	HashMap<String, Ref<Resource>> internal_res_by_id;
+	HashMap<const Resource *, String> internal_res_paths;
 
 	void save_unicode_string(const String &p_string);
 	static void save_ustring(Ref<FileAccess> f, const String &p_string);
@@ -272,6 +279,10 @@ protected:
 	void debug_print_properties(String res_name, String res_type, List<ResourceProperty> lrp);
 
 	Error load_ext_resource(const uint32_t i);
+	void _add_external_resource(const ExtResource &er);
+	void _add_internal_resource(const IntResource &ir);
+	void _set_internal_resource_path(int p_index, const String &p_path);
+	void _cache_internal_resource(const String &path, const Ref<Resource> &res);
 	int get_external_resource_save_order_by_path(const String &path);
 	String get_external_resource_path(const Ref<Resource> &path);
 	Ref<Resource> get_external_resource(const int subindex);
@@ -7,9 +7,61 @@
 struct IMA_ADPCM_State {
 	int16_t step_index = 0;
 	int32_t predictor = 0;
-	int32_t last_nibble = -1;
 };
 
+// The step and index tables folded into a difference and next step index for every (step index, nibble) pair,
+// so decoding a nibble is two lookups and a clamp. The differences keep the int16_t wraparound of AudioStreamWAV's decoder.
+struct IMA_ADPCM_Tables {
+	int16_t diff[89][16];
+	int16_t next_index[89][16];
+
+	IMA_ADPCM_Tables() {
+		static const int16_t _ima_adpcm_step_table[89] = {
+			7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+			19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+			50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+			130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+			337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+			876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+			2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+			5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+			15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+		};
+
+		static const int8_t _ima_adpcm_index_table[16] = {
+			-1, -1, -1, -1, 2, 4, 6, 8,
+			-1, -1, -1, -1, 2, 4, 6, 8
+		};
+
+		for (int idx = 0; idx < 89; idx++) {
+			int16_t step = _ima_adpcm_step_table[idx];
+			for (int nibble = 0; nibble < 16; nibble++) {
+				int16_t d = step >> 3;
+				if (nibble & 1) {
+					d += step >> 2;
+				}
+				if (nibble & 2) {
+					d += step >> 1;
+				}
+				if (nibble & 4) {
+					d += step;
+				}
+				if (nibble & 8) {
+					d = -d;
+				}
+				diff[idx][nibble] = d;
+				next_index[idx][nibble] = CLAMP(idx + _ima_adpcm_index_table[nibble], 0, 88);
+			}
+		}
+	}
+};
+
+static _FORCE_INLINE_ int16_t _decode_ima_adpcm_nibble(const IMA_ADPCM_Tables &p_tables, IMA_ADPCM_State &p_state, uint8_t p_nibble) {
+	p_state.predictor = CLAMP(p_state.predictor + p_tables.diff[p_state.step_index][p_nibble], -0x8000, 0x7FFF);
+	p_state.step_index = p_tables.next_index[p_state.step_index][p_nibble];
+	return p_state.predictor;
+}
+
 Ref<AudioStreamWAV> SampleLoaderCompat::convert_adpcm_to_16bit(const Ref<AudioStreamWAV> &p_sample) {
 	ERR_FAIL_COND_V_MSG(p_sample->get_format() != AudioStreamWAV::FORMAT_IMA_ADPCM, Ref<AudioStreamWAV>(), "Sample is not IMA ADPCM.");
 	Ref<AudioStreamWAV> new_sample = memnew(AudioStreamWAV);
@@ -21,94 +73,40 @@ Ref<AudioStreamWAV> SampleLoaderCompat::convert_adpcm_to_16bit(const Ref<AudioSt
 	new_sample->set_mix_rate(p_sample->get_mix_rate());
 	new_sample->set_stereo(p_sample->is_stereo());
 
+	static const IMA_ADPCM_Tables tables;
 	IMA_ADPCM_State p_ima_adpcm[2];
-	int32_t final, final_r;
-	int64_t p_offset = 0;
-	int64_t p_increment = 1;
 	auto data = p_sample->get_data();
 	bool is_stereo = p_sample->is_stereo();
-	int64_t p_amount = data.size() * (is_stereo ? 1 : 2); // number of samples for EACH channel, not total
+	int64_t src_size = data.size();
+	int64_t p_amount = src_size * (is_stereo ? 1 : 2); // number of samples for EACH channel, not total
 	Vector<uint8_t> dest_data;
 	dest_data.resize(p_amount * sizeof(int16_t) * (is_stereo ? 2 : 1)); // number of 16-bit samples * number of channels
 	int16_t *dest = (int16_t *)dest_data.ptrw();
-	while (p_amount) {
-		p_amount--;
-		int64_t pos = p_offset;
-
-		while (pos > p_ima_adpcm[0].last_nibble) {
-			static const int16_t _ima_adpcm_step_table[89] = {
-				7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
-				19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
-				50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
-				130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
-				337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
-				876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
-				2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
-				5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
-				15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
-			};
-
-			static const int8_t _ima_adpcm_index_table[16] = {
-				-1, -1, -1, -1, 2, 4, 6, 8,
-				-1, -1, -1, -1, 2, 4, 6, 8
-			};
-
-			for (int i = 0; i < (is_stereo ? 2 : 1); i++) {
-				int16_t nibble, diff, step;
-
-				p_ima_adpcm[i].last_nibble++;
-				const uint8_t *src_ptr = (const uint8_t *)data.ptr();
-				// src_ptr += AudioStreamWAV::DATA_PAD;
-				int source_index = (p_ima_adpcm[i].last_nibble >> 1) * (is_stereo ? 2 : 1) + i;
-				uint8_t nbb = src_ptr[source_index];
-				nibble = (p_ima_adpcm[i].last_nibble & 1) ? (nbb >> 4) : (nbb & 0xF);
-				step = _ima_adpcm_step_table[p_ima_adpcm[i].step_index];
-
-				p_ima_adpcm[i].step_index += _ima_adpcm_index_table[nibble];
-				if (p_ima_adpcm[i].step_index < 0) {
-					p_ima_adpcm[i].step_index = 0;
-				}
-				if (p_ima_adpcm[i].step_index > 88) {
-					p_ima_adpcm[i].step_index = 88;
-				}
-
-				diff = step >> 3;
-				if (nibble & 1) {
-					diff += step >> 2;
-				}
-				if (nibble & 2) {
-					diff += step >> 1;
-				}
-				if (nibble & 4) {
-					diff += step;
-				}
-				if (nibble & 8) {
-					diff = -diff;
-				}
-
-				p_ima_adpcm[i].predictor += diff;
-				if (p_ima_adpcm[i].predictor < -0x8000) {
-					p_ima_adpcm[i].predictor = -0x8000;
-				} else if (p_ima_adpcm[i].predictor > 0x7FFF) {
-					p_ima_adpcm[i].predictor = 0x7FFF;
-				}
-
-				//printf("%i - %i - pred %i\n",int(p_ima_adpcm[i].last_nibble),int(nibble),int(p_ima_adpcm[i].predictor));
-			}
+	const uint8_t *src = data.ptr();
+
+	// Each byte holds two consecutive samples of one channel, low nibble first.
+	// Stereo data alternates one byte of each channel, so a pair of bytes decodes to two interleaved frames.
+	if (!is_stereo) {
+		for (int64_t i = 0; i < src_size; i++) {
+			uint8_t nbb = src[i];
+			*dest++ = _decode_ima_adpcm_nibble(tables, p_ima_adpcm[0], nbb & 0xF);
+			*dest++ = _decode_ima_adpcm_nibble(tables, p_ima_adpcm[0], nbb >> 4);
 		}
-
-		final = p_ima_adpcm[0].predictor;
-		if (is_stereo) {
-			final_r = p_ima_adpcm[1].predictor;
+	} else {
+		int64_t pairs = src_size >> 1;
+		for (int64_t i = 0; i < pairs; i++) {
+			uint8_t nbb_l = src[i * 2];
+			uint8_t nbb_r = src[i * 2 + 1];
+			*dest++ = _decode_ima_adpcm_nibble(tables, p_ima_adpcm[0], nbb_l & 0xF);
+			*dest++ = _decode_ima_adpcm_nibble(tables, p_ima_adpcm[1], nbb_r & 0xF);
+			*dest++ = _decode_ima_adpcm_nibble(tables, p_ima_adpcm[0], nbb_l >> 4);
+			*dest++ = _decode_ima_adpcm_nibble(tables, p_ima_adpcm[1], nbb_r >> 4);
 		}
-
-		*dest = final;
-		dest++;
-		if (is_stereo) {
-			*dest = final_r;
-			dest++;
+		if (src_size & 1) {
+			// odd sized data has no right channel byte for the last frame
+			*dest++ = _decode_ima_adpcm_nibble(tables, p_ima_adpcm[0], src[src_size - 1] & 0xF);
+			*dest++ = _decode_ima_adpcm_nibble(tables, p_ima_adpcm[1], 0);
 		}
-		p_offset += p_increment;
 	}
 	new_sample->set_data(dest_data);
 	return new_sample;
@@ -212,4 +210,6 @@ Ref<AudioStreamWAV> SampleLoaderCompat::load_wav(const String &p_path, Error *r_
 	memdelete(loader);
 	return sample;
 }
-void SampleLoaderCompat::_bind_methods() {}
+void SampleLoaderCompat::_bind_methods() {
+	ClassDB::bind_static_method(get_class_static(), D_METHOD("convert_adpcm_to_16bit", "sample"), &SampleLoaderCompat::convert_adpcm_to_16bit);
+}
@@ -1,5 +1,6 @@
 #include "texture_loader_compat.h"
 #include "image_enum_compat.h"
+#include "png_compat.h"
 #include "resource_loader_compat.h"
 #include "webp_compat.h"
 
@@ -21,21 +22,36 @@ enum FormatBits {
 	FORMAT_BIT_DETECT_ROUGNESS = 1 << 27,
 };
 
-void TextureLoaderCompat::_bind_methods() {}
+void TextureLoaderCompat::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("load_image_from_tex", "path"), &TextureLoaderCompat::_load_image_from_tex_bind);
+}
+
+// errors are reported through the console and a null image
+Ref<Image> TextureLoaderCompat::_load_image_from_tex_bind(const String &p_path) {
+	return load_image_from_tex(p_path, nullptr);
+}
 
 TextureLoaderCompat::TextureVersionType TextureLoaderCompat::recognize(const String &p_path, Error *r_err) {
+	return _recognize(GDRESettings::get_singleton()->get_res_path(p_path), r_err);
+}
+
+// res_path must already be resolved with get_res_path()
+TextureLoaderCompat::TextureVersionType TextureLoaderCompat::_recognize(const String &res_path, Error *r_err) {
 	Error err;
 	if (!r_err) {
 		r_err = &err;
 	}
-	const String res_path = GDRESettings::get_singleton()->get_res_path(p_path);
-	Ref<FileAccess> f = FileAccess::open(res_path, FileAccess::READ, r_err);
+	*r_err = OK;
+	uint8_t header[4] = { 0, 0, 0, 0 };
+	// magics of the pack's textures are read when the pack is loaded, only open the file if it wasn't
+	if (!GDRESettings::get_singleton()->get_cached_texture_magic(res_path, header)) {
+		Ref<FileAccess> f = FileAccess::open(res_path, FileAccess::READ, r_err);
 
-	ERR_FAIL_COND_V_MSG(*r_err != OK || f.is_null(), FORMAT_NOT_TEXTURE, "Can't open texture file " + p_path);
+		ERR_FAIL_COND_V_MSG(*r_err != OK || f.is_null(), FORMAT_NOT_TEXTURE, "Can't open texture file " + res_path);
 
-	uint8_t header[4];
-	f->get_buffer(header, 4);
-	//Only reading the header
+		//Only reading the header
+		f->get_buffer(header, 4);
+	}
 	if (header[0] == 'G' && header[1] == 'D' && header[2] == 'S' && header[3] == 'T') {
 		return TextureVersionType::FORMAT_V3_STREAM_TEXTURE2D;
 	} else if (header[0] == 'G' && header[1] == 'D' && header[2] == '3' && header[3] == 'T') {
@@ -43,7 +59,7 @@ TextureLoaderCompat::TextureVersionType TextureLoaderCompat::recognize(const Str
 	} else if (header[0] == 'G' && header[1] == 'D' && header[2] == 'A' && header[3] == 'T') {
 		return TextureVersionType::FORMAT_V3_STREAM_TEXTUREARRAY;
 	} else if (header[0] == 'G' && header[1] == 'S' && header[2] == 'T' && header[3] == 'L') {
-		String ext = p_path.get_extension();
+		String ext = res_path.get_extension();
 		if (ext == "ctexarray" || ext == "ccube" || ext == "ccubearray") {
 			return TextureVersionType::FORMAT_V4_COMPRESSED_TEXTURELAYERED;
 		}
@@ -53,26 +69,24 @@ TextureLoaderCompat::TextureVersionType TextureLoaderCompat::recognize(const Str
 	} else if ((header[0] == 'R' && header[1] == 'S' && header[2] == 'R' && header[3] == 'C') ||
 			(header[0] == 'R' && header[1] == 'S' && header[2] == 'C' && header[3] == 'C')) {
 		// check if this is a V2 texture
-		ResourceFormatLoaderCompat rlc;
-		Ref<ImportInfo> i_info = ImportInfo::load_from_file(res_path);
-
-		if (*r_err == ERR_PRINTER_ON_FIRE) {
-			// no import metadata
-			*r_err = OK;
-		} else if (*r_err) {
-			ERR_FAIL_V_MSG(FORMAT_NOT_TEXTURE, "Can't open texture file " + p_path);
+		// the import metadata of v2 resources was already loaded with the pack, fall back to loading it here
+		Ref<ImportInfo> i_info = GDRESettings::get_singleton()->get_import_info_by_file(res_path);
+		if (i_info.is_null()) {
+			i_info = ImportInfo::load_from_file(res_path);
 		}
-		String type = i_info->get_type();
-		if (type == "Texture") {
-			return FORMAT_V2_TEXTURE;
-		} else if (type == "ImageTexture") {
-			return FORMAT_V2_IMAGE_TEXTURE;
-		} else if (type == "AtlasTexture") {
-			return FORMAT_V2_ATLAS_TEXTURE;
-		} else if (type == "LargeTexture") {
-			return FORMAT_V2_LARGE_TEXTURE;
-		} else if (type == "CubeMap") {
-			return FORMAT_V2_CUBEMAP;
+		if (i_info.is_valid()) {
+			String type = i_info->get_type();
+			if (type == "Texture") {
+				return FORMAT_V2_TEXTURE;
+			} else if (type == "ImageTexture") {
+				return FORMAT_V2_IMAGE_TEXTURE;
+			} else if (type == "AtlasTexture") {
+				return FORMAT_V2_ATLAS_TEXTURE;
+			} else if (type == "LargeTexture") {
+				return FORMAT_V2_LARGE_TEXTURE;
+			} else if (type == "CubeMap") {
+				return FORMAT_V2_CUBEMAP;
+			}
 		}
 	}
 	*r_err = ERR_FILE_UNRECOGNIZED;
@@ -180,60 +194,46 @@ Error TextureLoaderCompat::load_image_from_fileV3(Ref<FileAccess> f, int tw, int
 			mipmaps--;
 		}
 
-		// mipmaps need to be read independently, they will be later combined
-		Vector<Ref<Image>> mipmap_images;
-		int total_size = 0;
-
-		for (uint32_t i = 0; i < mipmaps; i++) {
-			if (i) {
-				size = f->get_32();
-			}
-			Vector<uint8_t> pv;
-			pv.resize(size);
-			{
-				uint8_t *wr = pv.ptrw();
-				f->get_buffer(wr, size);
-			}
-
-			Ref<Image> img;
-			if (df & FORMAT_BIT_PNG) {
-				img = Image::png_unpacker(pv);
-			} else {
-				img = WebPCompat::webp_unpack_v2v3(pv);
-			}
-			ERR_FAIL_COND_V_MSG(img.is_null() || img->is_empty(), ERR_FILE_CORRUPT, "File is corrupt");
-
-			if (i != 0) {
-				img->convert(mipmap_images[0]->get_format()); // ensure the same format for all mipmaps
-			}
+		// The first level tells us the format and size of the whole chain, so the final buffer is allocated once
+		// and every level is decoded straight into its slot
+		Vector<uint8_t> pv;
+		pv.resize(size);
+		ERR_FAIL_COND_V_MSG(f->get_buffer(pv.ptrw(), size) != size, ERR_FILE_CORRUPT, "File is corrupt");
 
-			total_size += img->get_data().size();
-
-			mipmap_images.push_back(img);
+		int w = 0;
+		int h = 0;
+		if (df & FORMAT_BIT_PNG) {
+			ERR_FAIL_COND_V_MSG(PNGCompat::png_get_info(pv, w, h, format) != OK, ERR_FILE_CORRUPT, "File is corrupt");
+		} else {
+			ERR_FAIL_COND_V_MSG(WebPCompat::webp_get_info_v2v3(pv, w, h, format) != OK, ERR_FILE_CORRUPT, "File is corrupt");
 		}
 
-		//print_line("mipmap read total: " + itos(mipmap_images.size()));
-		format = mipmap_images[0]->get_format();
-
-		if (mipmap_images.size() == 1) {
-			image = mipmap_images[0];
+		if (mipmaps == 1) {
+			image = (df & FORMAT_BIT_PNG) ? Image::png_unpacker(pv) : WebPCompat::webp_unpack_v2v3(pv);
+			ERR_FAIL_COND_V_MSG(image.is_null() || image->is_empty(), ERR_FILE_CORRUPT, "File is corrupt");
 		} else {
+			// a stex always stores the full chain, anything else can't be turned into a mipmapped image
+			ERR_FAIL_COND_V_MSG((int)mipmaps - 1 != Image::get_image_required_mipmaps(w, h, format), ERR_FILE_CORRUPT, "File is corrupt");
 			Vector<uint8_t> img_data;
-			img_data.resize(total_size);
-
-			{
-				uint8_t *wr = img_data.ptrw();
-
-				int ofs = 0;
-				for (int i = 0; i < mipmap_images.size(); i++) {
-					Vector<uint8_t> id = mipmap_images[i]->get_data();
-					int len = id.size();
-					const uint8_t *r = id.ptr();
-					memcpy(&wr[ofs], r, len);
-					ofs += len;
+			img_data.resize(Image::get_image_data_size(w, h, format, true));
+			uint8_t *wr = img_data.ptrw();
+
+			for (uint32_t i = 0; i < mipmaps; i++) {
+				if (i) {
+					size = f->get_32();
+					pv.resize(size);
+					ERR_FAIL_COND_V_MSG(f->get_buffer(pv.ptrw(), size) != size, ERR_FILE_CORRUPT, "File is corrupt");
+				}
+				int ofs = Image::get_image_mipmap_offset(w, h, format, i);
+				int len = (i + 1 < mipmaps ? Image::get_image_mipmap_offset(w, h, format, i + 1) : img_data.size()) - ofs;
+				// levels stored in another format than the first are converted to it
+				if (df & FORMAT_BIT_PNG) {
+					ERR_FAIL_COND_V_MSG(PNGCompat::png_unpack_into(pv, format, wr + ofs, len) != OK, ERR_FILE_CORRUPT, "File is corrupt");
+				} else {
+					ERR_FAIL_COND_V_MSG(WebPCompat::webp_unpack_v2v3_into(pv, format, wr + ofs, len) != OK, ERR_FILE_CORRUPT, "File is corrupt");
 				}
 			}
-			image->initialize_data(tw, th, true, format, img_data);
+			image->initialize_data(w, h, true, format, img_data);
 		}
 	} else {
 		//look for regular format
@@ -304,10 +304,10 @@ Error TextureLoaderCompat::load_image_from_fileV3(Ref<FileAccess> f, int tw, int
 	return OK;
 }
 
-Ref<CompressedTexture2D> TextureLoaderCompat::_load_texture2d(const String &p_path, Ref<Image> &image, bool &size_override, int ver_major, Error *r_err) const {
+// Only decodes the image data, no texture resource is created
+Error TextureLoaderCompat::_load_image2d(const String &p_path, int ver_major, Ref<Image> &image, int &r_width, int &r_height, bool &r_size_override) const {
 	int lw, lh, lwc, lhc, lflags;
 	Error err;
-	Ref<CompressedTexture2D> texture;
 	if (ver_major == 2) {
 		err = _load_data_tex_v2(p_path, lw, lh, lwc, lhc, lflags, image);
 	} else if (ver_major == 3) {
@@ -317,6 +317,19 @@ Ref<CompressedTexture2D> TextureLoaderCompat::_load_texture2d(const String &p_pa
 	} else {
 		err = ERR_INVALID_PARAMETER;
 	}
+	if (err != OK) {
+		return err;
+	}
+	r_width = lwc ? lwc : lw;
+	r_height = lhc ? lhc : lh;
+	r_size_override = lwc || lhc;
+	return OK;
+}
+
+Ref<CompressedTexture2D> TextureLoaderCompat::_load_texture2d(const String &p_path, Ref<Image> &image, bool &size_override, int ver_major, Error *r_err) const {
+	int w, h;
+	Ref<CompressedTexture2D> texture;
+	Error err = _load_image2d(p_path, ver_major, image, w, h, size_override);
 	if (r_err)
 		*r_err = err;
 	// deprecated format
@@ -325,11 +338,10 @@ Ref<CompressedTexture2D> TextureLoaderCompat::_load_texture2d(const String &p_pa
 	}
 	ERR_FAIL_COND_V_MSG(err != OK, texture, "Failed to load image from texture file " + p_path);
 	texture.instantiate();
-	texture->set("w", lwc ? lwc : lw);
-	texture->set("h", lhc ? lhc : lh);
+	texture->set("w", w);
+	texture->set("h", h);
 	texture->set("path_to_file", p_path);
 	texture->set("format", image->get_format());
-	size_override = lwc || lhc;
 	// we no longer care about flags, apparently
 	return texture;
 }
@@ -599,21 +611,25 @@ Error TextureLoaderCompat::_load_data_ctexlayered_v4(const String &p_path, Vecto
 	return OK;
 }
 
+// Only decodes the layers/slices, no texture resource is created
+Error TextureLoaderCompat::_load_images_layered(const String &p_path, int ver_major, Vector<Ref<Image>> &r_data, Image::Format &r_format, int &r_width, int &r_height, int &r_depth, int &r_type, bool &r_mipmaps) const {
+	if (ver_major == 2) {
+		return ERR_UNAVAILABLE;
+	} else if (ver_major == 3) {
+		r_type = 0;
+		return _load_layered_texture_v3(p_path, r_data, r_format, r_width, r_height, r_depth, r_mipmaps);
+	} else if (ver_major == 4) {
+		return _load_data_ctexlayered_v4(p_path, r_data, r_format, r_width, r_height, r_depth, r_type, r_mipmaps);
+	}
+	return ERR_INVALID_PARAMETER;
+}
+
 Ref<CompressedTexture3D> TextureLoaderCompat::_load_texture3d(const String p_path, Vector<Ref<Image>> &r_data, Error *r_err, int ver_major) const {
 	int lw, lh, ld, ltype;
 	bool mipmaps;
 	Image::Format fmt;
-	Error err;
 	Ref<CompressedTexture3D> texture;
-	if (ver_major == 2) {
-		err = ERR_UNAVAILABLE;
-	} else if (ver_major == 3) {
-		err = _load_layered_texture_v3(p_path, r_data, fmt, lw, lh, ld, mipmaps);
-	} else if (ver_major == 4) {
-		err = _load_data_ctexlayered_v4(p_path, r_data, fmt, lw, lh, ld, ltype, mipmaps);
-	} else {
-		err = ERR_INVALID_PARAMETER;
-	}
+	Error err = _load_images_layered(p_path, ver_major, r_data, fmt, lw, lh, ld, ltype, mipmaps);
 	if (r_err)
 		*r_err = err;
 	ERR_FAIL_COND_V_MSG(err == ERR_UNAVAILABLE, texture, "V2 Texture3d conversion unimplemented");
@@ -633,17 +649,7 @@ Ref<CompressedTextureLayered> TextureLoaderCompat::_load_texture_layered(const S
 
 	bool mipmaps;
 	Image::Format fmt;
-	Error err;
-	if (ver_major == 2) {
-		err = ERR_UNAVAILABLE;
-	} else if (ver_major == 3) {
-		err = _load_layered_texture_v3(p_path, r_data, fmt, lw, lh, ld, mipmaps);
-		type = 0;
-	} else if (ver_major == 4) {
-		err = _load_data_ctexlayered_v4(p_path, r_data, fmt, lw, lh, ld, type, mipmaps);
-	} else {
-		err = ERR_INVALID_PARAMETER;
-	}
+	Error err = _load_images_layered(p_path, ver_major, r_data, fmt, lw, lh, ld, type, mipmaps);
 	if (r_err)
 		*r_err = err;
 	ERR_FAIL_COND_V_MSG(err == ERR_UNAVAILABLE, Ref<Resource>(), "V2 TextureLayered conversion unimplemented");
@@ -671,7 +677,7 @@ Ref<CompressedTextureLayered> TextureLoaderCompat::_load_texture_layered(const S
 Ref<CompressedTextureLayered> TextureLoaderCompat::load_texture_layered(const String p_path, Error *r_err) {
 	Error err;
 	const String res_path = GDRESettings::get_singleton()->get_res_path(p_path);
-	TextureLoaderCompat::TextureVersionType t = recognize(res_path, &err);
+	TextureLoaderCompat::TextureVersionType t = _recognize(res_path, &err);
 
 	if (t == FORMAT_NOT_TEXTURE) {
 		if (r_err) {
@@ -705,7 +711,7 @@ Ref<CompressedTextureLayered> TextureLoaderCompat::load_texture_layered(const St
 Ref<CompressedTexture3D> TextureLoaderCompat::load_texture3d(const String p_path, Error *r_err) {
 	Error err;
 	const String res_path = GDRESettings::get_singleton()->get_res_path(p_path);
-	TextureLoaderCompat::TextureVersionType t = recognize(res_path, &err);
+	TextureLoaderCompat::TextureVersionType t = _recognize(res_path, &err);
 	if (t == FORMAT_NOT_TEXTURE) {
 		if (r_err) {
 			*r_err = err;
@@ -743,7 +749,7 @@ Ref<CompressedTexture3D> TextureLoaderCompat::load_texture3d(const String p_path
 Ref<CompressedTexture2D> TextureLoaderCompat::load_texture2d(const String p_path, Error *r_err) {
 	Error err;
 	const String res_path = GDRESettings::get_singleton()->get_res_path(p_path);
-	TextureLoaderCompat::TextureVersionType t = recognize(res_path, &err);
+	TextureLoaderCompat::TextureVersionType t = _recognize(res_path, &err);
 	if (t == FORMAT_NOT_TEXTURE) {
 		if (r_err) {
 			*r_err = err;
@@ -782,7 +788,7 @@ Ref<CompressedTexture2D> TextureLoaderCompat::load_texture2d(const String p_path
 Ref<Texture> TextureLoaderCompat::load_texture(const String p_path, Error *r_err) {
 	Error err;
 	const String res_path = GDRESettings::get_singleton()->get_res_path(p_path);
-	TextureLoaderCompat::TextureVersionType t = recognize(res_path, &err);
+	TextureLoaderCompat::TextureVersionType t = _recognize(res_path, &err);
 	if (t == FORMAT_NOT_TEXTURE) {
 		if (r_err) {
 			*r_err = err;
@@ -828,7 +834,7 @@ Vector<Ref<Image>> TextureLoaderCompat::load_images_from_layered_tex(const Strin
 	Vector<Ref<Image>> data;
 	const String res_path = GDRESettings::get_singleton()->get_res_path(p_path);
 
-	TextureLoaderCompat::TextureVersionType t = recognize(res_path, &err);
+	TextureLoaderCompat::TextureVersionType t = _recognize(res_path, &err);
 	if (t == FORMAT_NOT_TEXTURE) {
 		if (r_err) {
 			*r_err = err;
@@ -836,25 +842,17 @@ Vector<Ref<Image>> TextureLoaderCompat::load_images_from_layered_tex(const Strin
 		ERR_FAIL_COND_V_MSG(err == ERR_FILE_UNRECOGNIZED, data, "File " + res_path + " is not a texture.");
 		ERR_FAIL_COND_V(err != OK, data);
 	}
-	int type;
-	Ref<Resource> res;
-	int ver_major = get_ver_major_from_textype(t);
 	auto textype = get_type_enum_from_version_type(t);
-	switch (textype) {
-		case TEXTURE_TYPE_3D:
-			res = _load_texture3d(res_path, data, &err, ver_major);
-			break;
-		case TEXTURE_TYPE_LAYERED:
-			res = _load_texture_layered(res_path, data, type, &err, ver_major);
-			break;
-		default:
-			if (r_err) {
-				*r_err = ERR_INVALID_PARAMETER;
-			}
-			ERR_FAIL_V_MSG(data, "Not a 3d image texture: " + res_path);
-			break;
+	if (textype != TEXTURE_TYPE_3D && textype != TEXTURE_TYPE_LAYERED) {
+		if (r_err) {
+			*r_err = ERR_INVALID_PARAMETER;
+		}
+		ERR_FAIL_V_MSG(data, "Not a 3d image texture: " + res_path);
 	}
-
+	int w, h, d, type;
+	bool mipmaps;
+	Image::Format fmt;
+	err = _load_images_layered(res_path, get_ver_major_from_textype(t), data, fmt, w, h, d, type, mipmaps);
 	if (r_err) {
 		*r_err = err;
 	}
@@ -862,10 +860,59 @@ Vector<Ref<Image>> TextureLoaderCompat::load_images_from_layered_tex(const Strin
 	return data;
 }
 
+// Decodes a texture straight to images without creating texture resources or RenderingServer textures.
+// 2d textures return a single image (with its mipmaps), 3d and layered textures return one image per slice/layer.
+Vector<Ref<Image>> TextureLoaderCompat::load_images_from_tex(const String p_path, Error *r_err) {
+	Error err;
+	Vector<Ref<Image>> data;
+	const String res_path = GDRESettings::get_singleton()->get_res_path(p_path);
+	TextureLoaderCompat::TextureVersionType t = _recognize(res_path, &err);
+	if (t == FORMAT_NOT_TEXTURE) {
+		if (r_err) {
+			*r_err = err;
+		}
+		ERR_FAIL_COND_V_MSG(err == ERR_FILE_UNRECOGNIZED, data, "File " + p_path + " is not a texture.");
+		ERR_FAIL_COND_V(err != OK, data);
+	}
+
+	int ver_major = get_ver_major_from_textype(t);
+	switch (get_type_enum_from_version_type(t)) {
+		case TEXTURE_TYPE_2D: {
+			Ref<Image> image;
+			image.instantiate();
+			int w, h;
+			bool size_override;
+			err = _load_image2d(res_path, ver_major, image, w, h, size_override);
+			if (err == OK) {
+				data.push_back(image);
+			}
+		} break;
+		case TEXTURE_TYPE_3D:
+		case TEXTURE_TYPE_LAYERED: {
+			int w, h, d, type;
+			bool mipmaps;
+			Image::Format fmt;
+			err = _load_images_layered(res_path, ver_major, data, fmt, w, h, d, type, mipmaps);
+		} break;
+		default: {
+			err = ERR_UNAVAILABLE;
+		} break;
+	}
+	if (r_err) {
+		*r_err = err;
+	}
+	// deprecated format, or a texture type we can't decode yet
+	if (err == ERR_UNAVAILABLE) {
+		return Vector<Ref<Image>>();
+	}
+	ERR_FAIL_COND_V_MSG(err != OK, Vector<Ref<Image>>(), "Failed to load images from " + p_path);
+	return data;
+}
+
 Ref<Image> TextureLoaderCompat::load_image_from_tex(const String p_path, Error *r_err) {
 	Error err;
 	const String res_path = GDRESettings::get_singleton()->get_res_path(p_path);
-	TextureLoaderCompat::TextureVersionType t = recognize(res_path, &err);
+	TextureLoaderCompat::TextureVersionType t = _recognize(res_path, &err);
 	if (t == FORMAT_NOT_TEXTURE) {
 		if (r_err) {
 			*r_err = err;
@@ -880,14 +927,16 @@ Ref<Image> TextureLoaderCompat::load_image_from_tex(const String p_path, Error *
 
 	Ref<Image> image;
 	image.instantiate();
+	int w, h;
 	bool size_override;
 
-	_load_texture2d(res_path, image, size_override, ver_major, &err);
+	// only the image is wanted here, so don't create a texture resource for it
+	err = _load_image2d(res_path, ver_major, image, w, h, size_override);
 	if (r_err) {
 		*r_err = err;
 	}
 	// deprecated format
-	if (*r_err == ERR_UNAVAILABLE) {
+	if (err == ERR_UNAVAILABLE) {
 		return Ref<Image>();
 	}
 
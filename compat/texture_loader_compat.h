@@ -47,10 +47,16 @@ private:
 	Error _load_data_stex2d_v3(const String &p_path, int &tw, int &th, int &tw_custom, int &th_custom, int &flags, Ref<Image> &image, int p_size_limit = 0) const;
 	Error _load_data_tex_v2(const String &p_path, int &tw, int &th, int &tw_custom, int &th_custom, int &flags, Ref<Image> &image) const;
 
+	Error _load_image2d(const String &p_path, int ver_major, Ref<Image> &image, int &r_width, int &r_height, bool &r_size_override) const;
+	Error _load_images_layered(const String &p_path, int ver_major, Vector<Ref<Image>> &r_data, Image::Format &r_format, int &r_width, int &r_height, int &r_depth, int &r_type, bool &r_mipmaps) const;
+
 	Ref<CompressedTextureLayered> _load_texture_layered(const String p_path, Vector<Ref<Image>> &r_data, int &type, Error *r_err, int ver_major) const;
 	Ref<CompressedTexture3D> _load_texture3d(const String p_path, Vector<Ref<Image>> &r_data, Error *r_err, int ver_major) const;
 	Ref<CompressedTexture2D> _load_texture2d(const String &p_path, Ref<Image> &image, bool &size_override, int ver_major, Error *r_err) const;
 
+	static TextureVersionType _recognize(const String &res_path, Error *r_err);
+	Ref<Image> _load_image_from_tex_bind(const String &p_path);
+
 protected:
 	static void _bind_methods();
 
@@ -65,6 +71,7 @@ public:
 	Ref<CompressedTexture2D> load_texture2d(const String p_path, Error *r_err);
 	Ref<Texture> load_texture(const String p_path, Error *r_err);
 	Vector<Ref<Image>> load_images_from_layered_tex(const String p_path, Error *r_err);
+	Vector<Ref<Image>> load_images_from_tex(const String p_path, Error *r_err);
 	Ref<Image> load_image_from_tex(const String p_path, Error *r_err);
 	Ref<Image> load_image_from_bitmap(const String p_path, Error *r_err);
 };
@@ -9,6 +9,135 @@ static String rtosfix(double p_value) {
 		return rtoss(p_value);
 }
 
+// Same output as rtosfix() (rtoss() is String::num_scientific()), written into r_buf instead of a new String
+static int _format_real_fix(char *r_buf, int p_size, double p_value) {
+	if (p_value == 0.0) {
+		return snprintf(r_buf, p_size, "0");
+	} else if (Math::is_nan(p_value)) {
+		return snprintf(r_buf, p_size, "nan");
+	} else if (Math::is_inf(p_value)) {
+		return snprintf(r_buf, p_size, signbit(p_value) ? "-inf" : "inf");
+	}
+#if defined(__MINGW32__) && defined(_TWO_DIGIT_EXPONENT) && !defined(_UCRT)
+	// This is for MinGW, which would otherwise use three digit exponents, like num_scientific does
+	unsigned int old_exponent_format = _set_output_format(_TWO_DIGIT_EXPONENT);
+#endif
+	int len = snprintf(r_buf, p_size, "%lg", p_value);
+#if defined(__MINGW32__) && defined(_TWO_DIGIT_EXPONENT) && !defined(_UCRT)
+	_set_output_format(old_exponent_format);
+#endif
+	return len;
+}
+
+// Packed arrays are formatted into a local buffer that is handed to the store function in chunks,
+// instead of storing a separate String for every element
+class PackedArrayWriterCompat {
+	static constexpr int CHUNK_SIZE = 4096;
+	static constexpr int MAX_ELEMENT_SIZE = 64;
+	char buf[CHUNK_SIZE + MAX_ELEMENT_SIZE + 1];
+	int pos = 0;
+	VariantWriterCompat::StoreStringFunc store_string_func;
+	void *store_string_ud;
+
+	void _check_flush() {
+		if (pos >= CHUNK_SIZE) {
+			flush();
+		}
+	}
+
+public:
+	void append_separator(int p_index) {
+		if (p_index > 0) {
+			buf[pos++] = ',';
+			buf[pos++] = ' ';
+		}
+	}
+	void append_real(double p_value) {
+		pos += _format_real_fix(&buf[pos], MAX_ELEMENT_SIZE, p_value);
+		_check_flush();
+	}
+	void append_int(int64_t p_value) {
+		pos += snprintf(&buf[pos], MAX_ELEMENT_SIZE, "%lld", (long long)p_value);
+		_check_flush();
+	}
+	void flush() {
+		if (pos == 0) {
+			return;
+		}
+		// the output is always ASCII, so it can be copied straight into our own text writer
+		if (store_string_func == TextFileWriterCompat::store_string_func) {
+			((TextFileWriterCompat *)store_string_ud)->store_ascii(buf, pos);
+		} else {
+			buf[pos] = 0;
+			store_string_func(store_string_ud, String(buf));
+		}
+		pos = 0;
+	}
+
+	PackedArrayWriterCompat(VariantWriterCompat::StoreStringFunc p_store_string_func, void *p_store_string_ud) :
+			store_string_func(p_store_string_func), store_string_ud(p_store_string_ud) {}
+	~PackedArrayWriterCompat() {
+		flush();
+	}
+};
+
+TextFileWriterCompat::TextFileWriterCompat(const Ref<FileAccess> &p_file) :
+		f(p_file) {
+	buffer.resize(BUFFER_SIZE);
+	buffer_ptr = buffer.ptrw();
+}
+
+TextFileWriterCompat::~TextFileWriterCompat() {
+	flush();
+}
+
+void TextFileWriterCompat::store_ascii(const char *p_str, int p_len) {
+	while (p_len > 0) {
+		int count = MIN(p_len, BUFFER_SIZE - buffer_pos);
+		memcpy(&buffer_ptr[buffer_pos], p_str, count);
+		buffer_pos += count;
+		p_str += count;
+		p_len -= count;
+		if (buffer_pos == BUFFER_SIZE) {
+			flush();
+		}
+	}
+}
+
+void TextFileWriterCompat::store_string(const String &p_string) {
+	// ASCII is copied directly; the rest is encoded the same way FileAccess::store_string() does
+	const char32_t *str = p_string.ptr();
+	int len = p_string.length();
+	for (int i = 0; i < len; i++) {
+		if (str[i] >= 0x80) {
+			CharString cs = p_string.substr(i).utf8();
+			store_ascii(cs.get_data(), cs.length());
+			return;
+		}
+		buffer_ptr[buffer_pos++] = (uint8_t)str[i];
+		if (buffer_pos == BUFFER_SIZE) {
+			flush();
+		}
+	}
+}
+
+void TextFileWriterCompat::store_line(const String &p_line) {
+	store_string(p_line);
+	store_ascii("\n", 1);
+}
+
+void TextFileWriterCompat::flush() {
+	if (buffer_pos > 0) {
+		f->store_buffer(buffer_ptr, buffer_pos);
+		buffer_pos = 0;
+	}
+}
+
+Error TextFileWriterCompat::store_string_func(void *ud, const String &p_string) {
+	((TextFileWriterCompat *)ud)->store_string(p_string);
+	return OK;
+}
+
 Error VariantParserCompat::_parse_array(Array &array, Stream *p_stream, int &line, String &r_err_str, ResourceParser *p_res_parser) {
 	Token token;
 	bool need_comma = false;
@@ -585,17 +714,16 @@ Error VariantWriterCompat::write_compat(const Variant &p_variant, const uint32_t
 			} else {
 				p_store_string_func(p_store_string_ud, ver_major == 2 ? "ByteArray( " : "PoolByteArray( ");
 			}
-			String s;
 			Vector<uint8_t> data = p_variant;
 			int len = data.size();
 
 			const uint8_t *ptr = data.ptr();
+			PackedArrayWriterCompat writer(p_store_string_func, p_store_string_ud);
 			for (int i = 0; i < len; i++) {
-				if (i > 0)
-					p_store_string_func(p_store_string_ud, ", ");
-
-				p_store_string_func(p_store_string_ud, itos(ptr[i]));
+				writer.append_separator(i);
+				writer.append_int(ptr[i]);
 			}
+			writer.flush();
 			if (ver_major == 2 && is_pcfg) {
 				p_store_string_func(p_store_string_ud, " ]");
 			} else {
@@ -612,13 +740,12 @@ Error VariantWriterCompat::write_compat(const Variant &p_variant, const uint32_t
 			int len = data.size();
 
 			const int *ptr = data.ptr();
-
+			PackedArrayWriterCompat writer(p_store_string_func, p_store_string_ud);
 			for (int i = 0; i < len; i++) {
-				if (i > 0)
-					p_store_string_func(p_store_string_ud, ", ");
-
-				p_store_string_func(p_store_string_ud, itos(ptr[i]));
+				writer.append_separator(i);
+				writer.append_int(ptr[i]);
 			}
+			writer.flush();
 
 			if (ver_major == 2 && is_pcfg) {
 				p_store_string_func(p_store_string_ud, " ]");
@@ -637,12 +764,12 @@ Error VariantWriterCompat::write_compat(const Variant &p_variant, const uint32_t
 			Vector<real_t> data = p_variant;
 			int len = data.size();
 			const real_t *ptr = data.ptr();
-
+			PackedArrayWriterCompat writer(p_store_string_func, p_store_string_ud);
 			for (int i = 0; i < len; i++) {
-				if (i > 0)
-					p_store_string_func(p_store_string_ud, ", ");
-				p_store_string_func(p_store_string_ud, rtosfix(ptr[i]));
+				writer.append_separator(i);
+				writer.append_real(ptr[i]);
 			}
+			writer.flush();
 
 			if (ver_major == 2 && is_pcfg) {
 				p_store_string_func(p_store_string_ud, " ]");
@@ -686,12 +813,14 @@ Error VariantWriterCompat::write_compat(const Variant &p_variant, const uint32_t
 			Vector<Vector2> data = p_variant;
 			int len = data.size();
 			const Vector2 *ptr = data.ptr();
-
+			PackedArrayWriterCompat writer(p_store_string_func, p_store_string_ud);
 			for (int i = 0; i < len; i++) {
-				if (i > 0)
-					p_store_string_func(p_store_string_ud, ", ");
-				p_store_string_func(p_store_string_ud, rtosfix(ptr[i].x) + ", " + rtosfix(ptr[i].y));
+				writer.append_separator(i);
+				writer.append_real(ptr[i].x);
+				writer.append_separator(1);
+				writer.append_real(ptr[i].y);
 			}
+			writer.flush();
 
 			p_store_string_func(p_store_string_ud, " )");
 
@@ -702,12 +831,16 @@ Error VariantWriterCompat::write_compat(const Variant &p_variant, const uint32_t
 			Vector<Vector3> data = p_variant;
 			int len = data.size();
 			const Vector3 *ptr = data.ptr();
-
+			PackedArrayWriterCompat writer(p_store_string_func, p_store_string_ud);
 			for (int i = 0; i < len; i++) {
-				if (i > 0)
-					p_store_string_func(p_store_string_ud, ", ");
-				p_store_string_func(p_store_string_ud, rtosfix(ptr[i].x) + ", " + rtosfix(ptr[i].y) + ", " + rtosfix(ptr[i].z));
+				writer.append_separator(i);
+				writer.append_real(ptr[i].x);
+				writer.append_separator(1);
+				writer.append_real(ptr[i].y);
+				writer.append_separator(1);
+				writer.append_real(ptr[i].z);
 			}
+			writer.flush();
 
 			p_store_string_func(p_store_string_ud, " )");
 
@@ -720,13 +853,18 @@ Error VariantWriterCompat::write_compat(const Variant &p_variant, const uint32_t
 			int len = data.size();
 
 			const Color *ptr = data.ptr();
-
+			PackedArrayWriterCompat writer(p_store_string_func, p_store_string_ud);
 			for (int i = 0; i < len; i++) {
-				if (i > 0)
-					p_store_string_func(p_store_string_ud, ", ");
-
-				p_store_string_func(p_store_string_ud, rtosfix(ptr[i].r) + ", " + rtosfix(ptr[i].g) + ", " + rtosfix(ptr[i].b) + ", " + rtosfix(ptr[i].a));
-			}
+				writer.append_separator(i);
+				writer.append_real(ptr[i].r);
+				writer.append_separator(1);
+				writer.append_real(ptr[i].g);
+				writer.append_separator(1);
+				writer.append_real(ptr[i].b);
+				writer.append_separator(1);
+				writer.append_real(ptr[i].a);
+			}
+			writer.flush();
 			p_store_string_func(p_store_string_ud, " )");
 
 		} break;
@@ -16,6 +16,26 @@ public:
 	static Error parse_tag_assign_eof(VariantParser::Stream *p_stream, int &line, String &r_err_str, Tag &r_tag, String &r_assign, Variant &r_value, VariantParser::ResourceParser *p_res_parser = nullptr, bool p_simple_tag = false);
 };
 
+// Collects text as UTF-8 and writes it to the file in large blocks.
+// Pass store_string_func with the writer to VariantWriterCompat::write_compat to stream variants straight into it.
+class TextFileWriterCompat {
+	static constexpr int BUFFER_SIZE = 65536;
+	Ref<FileAccess> f;
+	Vector<uint8_t> buffer;
+	uint8_t *buffer_ptr = nullptr;
+	int buffer_pos = 0;
+
+public:
+	void store_string(const String &p_string);
+	void store_line(const String &p_line);
+	void store_ascii(const char *p_str, int p_len);
+	void flush();
+	static Error store_string_func(void *ud, const String &p_string);
+
+	TextFileWriterCompat(const Ref<FileAccess> &p_file);
+	~TextFileWriterCompat();
+};
+
 class VariantWriterCompat {
 public:
 	typedef Error (*StoreStringFunc)(void *ud, const String &p_string);
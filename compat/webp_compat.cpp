@@ -33,4 +33,46 @@ Ref<Image> webp_unpack_v2v3(const Vector<uint8_t> &p_buffer) {
 	return img;
 }
 
+// Reads the dimensions and the format webp_unpack_v2v3 would decode to, without decoding
+Error webp_get_info_v2v3(const Vector<uint8_t> &p_buffer, int &r_width, int &r_height, Image::Format &r_format) {
+	int size = p_buffer.size() - 4;
+	ERR_FAIL_COND_V(size <= 0, ERR_FILE_CORRUPT);
+	const uint8_t *r = p_buffer.ptr();
+
+	ERR_FAIL_COND_V(r[0] != 'W' || r[1] != 'E' || r[2] != 'B' || r[3] != 'P', ERR_FILE_CORRUPT);
+	WebPBitstreamFeatures features;
+	if (WebPGetFeatures(&r[4], size, &features) != VP8_STATUS_OK) {
+		ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, "Error unpacking WEBP image.");
+	}
+	r_width = features.width;
+	r_height = features.height;
+	r_format = features.has_alpha ? Image::FORMAT_RGBA8 : Image::FORMAT_RGB8;
+	return OK;
+}
+
+// Decodes into a caller-owned buffer, which must hold exactly width * height pixels of p_format (RGB8 or RGBA8).
+// libwebp adds or drops the alpha channel as needed, so this matches webp_unpack_v2v3 followed by Image::convert
+Error webp_unpack_v2v3_into(const Vector<uint8_t> &p_buffer, Image::Format p_format, uint8_t *r_dst, int p_dst_size) {
+	ERR_FAIL_COND_V(p_format != Image::FORMAT_RGBA8 && p_format != Image::FORMAT_RGB8, ERR_INVALID_PARAMETER);
+	int width, height;
+	Image::Format format;
+	Error err = webp_get_info_v2v3(p_buffer, width, height, format);
+	if (err != OK) {
+		return err;
+	}
+	int pixel_size = p_format == Image::FORMAT_RGBA8 ? 4 : 3;
+	ERR_FAIL_COND_V(width * height * pixel_size != p_dst_size, ERR_INVALID_PARAMETER);
+
+	const uint8_t *r = p_buffer.ptr();
+	int size = p_buffer.size() - 4;
+	bool errdec = false;
+	if (p_format == Image::FORMAT_RGBA8) {
+		errdec = WebPDecodeRGBAInto(&r[4], size, r_dst, p_dst_size, 4 * width) == nullptr;
+	} else {
+		errdec = WebPDecodeRGBInto(&r[4], size, r_dst, p_dst_size, 3 * width) == nullptr;
+	}
+	ERR_FAIL_COND_V_MSG(errdec, ERR_FILE_CORRUPT, "Failed decoding WebP image.");
+	return OK;
+}
+
 } //namespace WebPCompat
\ No newline at end of file
@@ -6,5 +6,7 @@
 
 namespace WebPCompat {
 Ref<Image> webp_unpack_v2v3(const Vector<uint8_t> &p_buffer);
+Error webp_get_info_v2v3(const Vector<uint8_t> &p_buffer, int &r_width, int &r_height, Image::Format &r_format);
+Error webp_unpack_v2v3_into(const Vector<uint8_t> &p_buffer, Image::Format p_format, uint8_t *r_dst, int p_dst_size);
 }
 #endif //WEBP_COMMON_H
\ No newline at end of file
@@ -100,7 +100,6 @@ private:
 	uint32_t pck_ver_minor;
 	uint32_t pck_ver_rev;
 	RBMap<String, Ref<PackedFileInfo>> pck_files;
-	Vector<Ref<PackedFileInfo>> pck_save_files;
 
 	NewPackDialog *pck_save_dialog;
 	FileDialog *pck_source_folder;
@@ -135,7 +134,6 @@ private:
 
 	void _pck_create_request(const String &p_path);
 	void _pck_save_prep();
-	uint64_t _pck_create_process_folder(EditorProgressGDDC *p_pr, const String &p_path, const String &p_rel, uint64_t p_offset, bool &p_cancel);
 	void _pck_save_request(const String &p_path);
 
 	Vector<String> res_files;
@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+"""Compares the per-revision bytecode tables with the ones from an older commit.
+
+Before the table-driven decompiler, every bytecode/bytecode_<rev>.cpp declared its own `enum Token` and
+`func_names[]`, and the header set the revision constants. Since then each revision declares a
+`revision_tokens[]` table of global tokens instead. This checks, for every revision, that:
+  - the token map lists the same tokens in the same order (TK_X -> G_TK_X),
+  - the built-in function names are the same and in the same order,
+  - bytecode_rev, bytecode_version, engine_ver_major and variant_ver_major are unchanged.
+
+Usage (from the repository root):
+    python3 misc/scripts/compare_bytecode_tables.py <git-rev-before-the-change>
+e.g.
+    python3 misc/scripts/compare_bytecode_tables.py 72db019^
+
+Exits with a non-zero status if any revision differs.
+
+    python3 misc/scripts/compare_bytecode_tables.py --dump-gd <git-rev-before-the-change>
+writes the old tables as GDScript instead, for standalone/tests/bytecode_revision_tables.gd.
+"""
+
+import glob
+import os
+import re
+import subprocess
+import sys
+
+REV_FILE_RE = re.compile(r"bytecode_([0-9a-f]{7})\.cpp$")
+
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def block_items(text, start_re):
+    m = re.search(start_re + r"\s*\{(.*?)\}", text, flags=re.S)
+    if not m:
+        return None
+    items = [i.strip() for i in m.group(1).split(",")]
+    return [i for i in items if i]
+
+
+def int_field(text, name):
+    m = re.search(r"\b" + name + r"\s*=\s*(0x[0-9a-fA-F]+|\d+)\s*;", text)
+    return int(m.group(1), 0) if m else None
+
+
+def parse_current(cpp_path):
+    text = strip_comments(open(cpp_path, encoding="utf-8").read())
+    return {
+        "tokens": [t[2:] if t.startswith("G_") else t for t in block_items(text, r"::revision_tokens\[\]\s*=") or []],
+        "funcs": block_items(text, r"::func_names\[\]\s*=") or [],
+        "bytecode_rev": int_field(text, "bytecode_rev"),
+        "bytecode_version": int_field(text, "bytecode_version"),
+        "engine_ver_major": int_field(text, "engine_ver_major"),
+        "variant_ver_major": int_field(text, "variant_ver_major"),
+    }
+
+
+def git_show(rev, path):
+    try:
+        return subprocess.check_output(["git", "show", rev + ":" + path], stderr=subprocess.DEVNULL).decode("utf-8")
+    except subprocess.CalledProcessError:
+        return None
+
+
+def parse_old(rev, cpp_path):
+    cpp = git_show(rev, cpp_path)
+    header = git_show(rev, cpp_path[:-4] + ".h")
+    if cpp is None or header is None:
+        return None
+    cpp = strip_comments(cpp)
+    header = strip_comments(header)
+    tokens = block_items(cpp, r"enum\s+Token") or []
+    # TK_MAX only terminated the enum
+    tokens = [t for t in tokens if t != "TK_MAX"]
+    if any("=" in t for t in tokens):
+        sys.exit("%s: explicit token values are not supported by this script" % cpp_path)
+    return {
+        "tokens": tokens,
+        "funcs": block_items(cpp, r"func_names\[\]\s*=") or [],
+        "bytecode_rev": int_field(header, "bytecode_rev"),
+        "bytecode_version": int_field(header, "bytecode_version"),
+        "engine_ver_major": int_field(header, "engine_ver_major"),
+        "variant_ver_major": int_field(header, "variant_ver_major"),
+    }
+
+
+def gd_list(items):
+    return "[" + ", ".join('"%s"' % i.strip('"') for i in items) + "]"
+
+
+def dump_gd(rev, paths):
+    print("extends RefCounted")
+    print()
+    print("# Generated with misc/scripts/compare_bytecode_tables.py --dump-gd %s, do not edit." % rev)
+    print("# Token ids, built-in functions and bytecode versions of every revision, as the per-revision decompilers")
+    print("# declared them before they were table-driven; the index in each list is the id used in the bytecode.")
+    print()
+    print("const REVISIONS = {")
+    for path in paths:
+        old = parse_old(rev, path.replace(os.sep, "/"))
+        if old is None:
+            continue
+        print('\t"%07x": {' % old["bytecode_rev"])
+        print('\t\t"bytecode_version": %d,' % old["bytecode_version"])
+        print('\t\t"variant_ver_major": %d,' % old["variant_ver_major"])
+        print('\t\t"tokens": %s,' % gd_list(old["tokens"]))
+        print('\t\t"funcs": %s,' % gd_list(old["funcs"]))
+        print("\t},")
+    print("}")
+    return 0
+
+
+def main():
+    args = sys.argv[1:]
+    dump = len(args) == 2 and args[0] == "--dump-gd"
+    if dump:
+        args = args[1:]
+    if len(args) != 1:
+        sys.exit(__doc__)
+    rev = args[0]
+    paths = sorted(p for p in glob.glob(os.path.join("bytecode", "bytecode_*.cpp")) if REV_FILE_RE.search(p))
+    if not paths:
+        sys.exit("No revision files found, run this from the repository root.")
+    if dump:
+        return dump_gd(rev, paths)
+
+    failed = 0
+    for path in paths:
+        git_path = path.replace(os.sep, "/")
+        old = parse_old(rev, git_path)
+        if old is None:
+            print("%s: not present at %s, skipped" % (git_path, rev))
+            continue
+        new = parse_current(path)
+        if not new["tokens"] or not new["funcs"]:
+            failed += 1
+            print("%s: could not find the revision tables" % git_path)
+            continue
+        diffs = [key for key in old if old[key] != new[key]]
+        if diffs:
+            failed += 1
+            print("%s: MISMATCH in %s" % (git_path, ", ".join(diffs)))
+            for key in diffs:
+                print("    old %s: %s" % (key, old[key]))
+                print("    new %s: %s" % (key, new[key]))
+    print("%d of %d revisions match %s" % (len(paths) - failed, len(paths), rev))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -10,12 +10,14 @@
 
 #include "bytecode/bytecode_versions.h"
 #include "compat/oggstr_loader_compat.h"
+#include "compat/sample_loader_compat.h"
 #include "compat/texture_loader_compat.h"
 #include "editor/gdre_editor.h"
 #include "utility/gdre_settings.h"
 #include "utility/glob.h"
 #include "utility/godotver.h"
 #include "utility/import_exporter.h"
+#include "utility/pck_creator.h"
 #include "utility/pck_dumper.h"
 
 #ifdef TOOLS_ENABLED
@@ -35,6 +37,7 @@ void initialize_gdsdecomp_module(ModuleInitializationLevel p_level) {
 
 	ClassDB::register_class<GodotREEditorStandalone>();
 	ClassDB::register_class<PckDumper>();
+	ClassDB::register_class<PckCreator>();
 	ClassDB::register_abstract_class<ImportInfo>();
 	ClassDB::register_class<ImportInfoModern>();
 	ClassDB::register_class<ImportInfov2>();
@@ -42,6 +45,7 @@ void initialize_gdsdecomp_module(ModuleInitializationLevel p_level) {
 	ClassDB::register_class<ImportInfoRemap>();
 	ClassDB::register_class<ImportExporter>();
 	ClassDB::register_class<OggStreamLoaderCompat>();
+	ClassDB::register_class<SampleLoaderCompat>();
 	ClassDB::register_class<TextureLoaderCompat>();
 	ClassDB::register_class<GDRESettings>();
 	ClassDB::register_class<Glob>();
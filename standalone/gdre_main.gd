@@ -89,6 +89,7 @@ func test_decomp(fname):
 
 func export_imports(output_dir:String, files: PackedStringArray):
 	var importer:ImportExporter = ImportExporter.new()
+	importer.set_num_jobs(num_jobs)
 	importer.export_imports(output_dir, files)
 	importer.reset()
 				
@@ -96,6 +97,7 @@ func export_imports(output_dir:String, files: PackedStringArray):
 func dump_files(output_dir:String, files: PackedStringArray, ignore_checksum_errors: bool = false) -> int:
 	var err:int = OK;
 	var pckdump = PckDumper.new()
+	pckdump.set_num_jobs(num_jobs)
 	if err == OK:
 		err = pckdump.check_md5_all_files()
 		if err != OK:
@@ -112,6 +114,35 @@ func dump_files(output_dir:String, files: PackedStringArray, ignore_checksum_err
 		print("ERROR: failed to load exe")
 	return err;
 
+func create_pck(input_dir: String, output_pck: String, pck_version: int, engine_version: String, enc_key: String):
+	input_dir = get_cli_abs_path(input_dir)
+	if output_pck == "":
+		output_pck = input_dir.trim_suffix("/") + ".pck"
+	else:
+		output_pck = get_cli_abs_path(output_pck)
+	var ver = engine_version.split(".")
+	if ver.size() < 2:
+		print("Error: --pck-engine-version must be in the format of <MAJOR>.<MINOR>[.<PATCH>]")
+		return
+	var creator = PckCreator.new()
+	creator.set_pack_version(pck_version)
+	creator.set_ver_major(int(ver[0]))
+	creator.set_ver_minor(int(ver[1]))
+	creator.set_ver_rev(int(ver[2]) if ver.size() > 2 else 0)
+	if (enc_key != ""):
+		if pck_version < 2:
+			print("Error: --key requires --pck-version=2, PCK version 1 does not support encryption")
+			return
+		if GDRESettings.set_encryption_key_string(enc_key) != OK:
+			print("Error: failed to set key!")
+			return
+		creator.set_encrypt_include_filters(["*.gd", "*.gdc", "*.gde"])
+	var err = creator.pck_create(output_pck, input_dir)
+	if err != OK:
+		print("Error: failed to create " + output_pck)
+		return
+	print("Created " + output_pck + " (" + str(creator.get_file_count()) + " files)")
+
 func print_usage():
 	print("Godot Reverse Engineering Tools")
 	print("")
@@ -129,9 +160,19 @@ func print_usage():
 	print("--output-dir=<DIR>\t\tOutput directory, defaults to <NAME_extracted>, or the project directory if one of specified")
 	print("--ignore-checksum-errors\t\tIgnore MD5 checksum errors when extracting/recovering")
 	print("--translation-only\t\tOnly extract translation files")
+	print("--jobs=<N>\t\tNumber of threads to use when decompiling scripts and exporting resources (defaults to all available threads, 1 to disable multithreading)")
+	print("\nPCK creation options:")
+	print("Usage: GDRE_Tools.exe --headless --pck-create=<DIR> --pck-engine-version=<MAJOR.MINOR.PATCH> [options]")
+	print("")
+	print("--pck-create=<DIR>\t\tThe directory to pack into a PCK")
+	print("--pck-engine-version=<MAJOR.MINOR.PATCH>\t\tThe engine version to write into the PCK header")
+	print("--pck-version=<N>\t\tPCK format version (1 for Godot 3.x, 2 for Godot 4.x, defaults to 1)")
+	print("--pck-output=<FILE>\t\tThe PCK to write, defaults to <DIR>.pck")
+	print("--key=<KEY>\t\tEncrypt scripts with this key (hex string, PCK version 2 only)")
 
 # TODO: remove this hack
 var translation_only = false
+var num_jobs = -1
 
 func copy_dir(src:String, dst:String) -> int:
 	var da:DirAccess = DirAccess.open(src)
@@ -250,6 +291,10 @@ func handle_cli() -> bool:
 	var enc_key: String = ""
 	var txt_to_bin: String = ""
 	var ignore_md5: bool = false
+	var pck_create_dir: String = ""
+	var pck_output: String = ""
+	var pck_version: int = 1
+	var pck_engine_version: String = ""
 	if (args.size() == 0 or (args.size() == 1 and args[0] == "res://gdre_main.tscn")):
 		return false
 	for i in range(args.size()):
@@ -267,6 +312,14 @@ func handle_cli() -> bool:
 			input_file = normalize_path(get_arg_value(arg))
 		if arg.begins_with("--txt-to-bin"):
 			txt_to_bin = normalize_path(get_arg_value(arg))	
+		elif arg.begins_with("--pck-create"):
+			pck_create_dir = normalize_path(get_arg_value(arg))
+		elif arg.begins_with("--pck-output"):
+			pck_output = normalize_path(get_arg_value(arg))
+		elif arg.begins_with("--pck-version"):
+			pck_version = int(get_arg_value(arg))
+		elif arg.begins_with("--pck-engine-version"):
+			pck_engine_version = get_arg_value(arg)
 		elif arg.begins_with("--output-dir"):
 			output_dir = normalize_path(get_arg_value(arg))
 		elif arg.begins_with("--key"):
@@ -275,6 +328,12 @@ func handle_cli() -> bool:
 			ignore_md5 = true
 		elif arg.begins_with("--translation-only"):
 			translation_only = true
+		elif arg.begins_with("--jobs"):
+			num_jobs = int(get_arg_value(arg))
+			if num_jobs < 1:
+				print("Error: --jobs must be at least 1")
+				get_tree().quit()
+				return true
 
 	if input_file != "":
 		recovery(input_file, output_dir, enc_key, false, ignore_md5)
@@ -286,6 +345,9 @@ func handle_cli() -> bool:
 		GDRESettings.unload_pack()
 		close_log()
 		get_tree().quit()
+	elif pck_create_dir != "":
+		create_pck(pck_create_dir, pck_output, pck_version, pck_engine_version, enc_key)
+		get_tree().quit()
 	elif txt_to_bin != "":
 		txt_to_bin = get_cli_abs_path(txt_to_bin)
 		output_dir = get_cli_abs_path(output_dir)
@@ -0,0 +1,326 @@
+extends RefCounted
+
+# Generated with misc/scripts/compare_bytecode_tables.py --dump-gd 72db019^, do not edit.
+# Token ids, built-in functions and bytecode versions of every revision, as the per-revision decompilers
+# declared them before they were table-driven; the index in each list is the id used in the bytecode.
+
+const REVISIONS = {
+	"015d36d": {
+		"bytecode_version": 12,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_NEWLINE", "TK_CONST_PI", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "instance_from_id"],
+	},
+	"054a2ac": {
+		"bytecode_version": 12,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_NEWLINE", "TK_CONST_PI", "TK_CONST_TAU", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "inverse_lerp", "range_lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "polar2cartesian", "cartesian2polar", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "instance_from_id", "len"],
+	},
+	"0b806ee": {
+		"bytecode_version": 1,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_ERROR", "TK_EOF"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "convert", "typeof", "str", "print", "printt", "printerr", "printraw", "range", "inst2dict", "dict2inst", "print_stack"],
+	},
+	"1a36141": {
+		"bytecode_version": 13,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_WHILE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_CLASS_NAME", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_AS", "TK_PR_VOID", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_PR_PUPPET", "TK_PR_REMOTESYNC", "TK_PR_MASTERSYNC", "TK_PR_PUPPETSYNC", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_FORWARD_ARROW", "TK_NEWLINE", "TK_CONST_PI", "TK_CONST_TAU", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "inverse_lerp", "range_lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "polar2cartesian", "cartesian2polar", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "print_debug", "push_error", "push_warning", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "get_stack", "instance_from_id", "len", "is_instance_valid"],
+	},
+	"1add52b": {
+		"bytecode_version": 11,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_CONST_PI", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "hash", "Color8", "print_stack", "instance_from_id"],
+	},
+	"1ca61a3": {
+		"bytecode_version": 13,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_CLASS_NAME", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_AS", "TK_PR_VOID", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_PR_PUPPET", "TK_PR_REMOTESYNC", "TK_PR_MASTERSYNC", "TK_PR_PUPPETSYNC", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_FORWARD_ARROW", "TK_NEWLINE", "TK_CONST_PI", "TK_CONST_TAU", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "inverse_lerp", "range_lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "polar2cartesian", "cartesian2polar", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "print_debug", "push_error", "push_warning", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "get_stack", "instance_from_id", "len", "is_instance_valid"],
+	},
+	"216a8aa": {
+		"bytecode_version": 12,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_NEWLINE", "TK_CONST_PI", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "inverse_lerp", "range_lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "instance_from_id", "len"],
+	},
+	"2185c01": {
+		"bytecode_version": 3,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "str", "print", "printt", "printerr", "printraw", "var2str", "str2var", "range", "load", "inst2dict", "dict2inst", "hash", "print_stack"],
+	},
+	"23381a5": {
+		"bytecode_version": 11,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_CONST_PI", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "hash", "Color8", "ColorN", "print_stack", "instance_from_id"],
+	},
+	"23441ec": {
+		"bytecode_version": 10,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_CONST_PI", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "hash", "Color8", "print_stack", "instance_from_id"],
+	},
+	"30c1229": {
+		"bytecode_version": 6,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "range", "load", "inst2dict", "dict2inst", "hash", "print_stack", "instance_from_id"],
+	},
+	"31ce3c5": {
+		"bytecode_version": 2,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_ERROR", "TK_EOF"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "str", "print", "printt", "printerr", "printraw", "range", "load", "inst2dict", "dict2inst", "print_stack"],
+	},
+	"3ea6d9f": {
+		"bytecode_version": 12,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_NEWLINE", "TK_CONST_PI", "TK_CONST_TAU", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "inverse_lerp", "range_lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "polar2cartesian", "cartesian2polar", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "print_debug", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "get_stack", "instance_from_id", "len", "is_instance_valid"],
+	},
+	"48f1d02": {
+		"bytecode_version": 5,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "range", "load", "inst2dict", "dict2inst", "hash", "print_stack", "instance_from_id"],
+	},
+	"4ee82a2": {
+		"bytecode_version": 11,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_CONST_PI", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "hash", "Color8", "print_stack", "instance_from_id"],
+	},
+	"506df14": {
+		"bytecode_version": 13,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_WHILE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_CLASS_NAME", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_AS", "TK_PR_VOID", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_PR_PUPPET", "TK_PR_REMOTESYNC", "TK_PR_MASTERSYNC", "TK_PR_PUPPETSYNC", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_FORWARD_ARROW", "TK_NEWLINE", "TK_CONST_PI", "TK_CONST_TAU", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "posmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "is_equal_approx", "is_zero_approx", "ease", "step_decimals", "stepify", "lerp", "lerp_angle", "inverse_lerp", "range_lerp", "smoothstep", "move_toward", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "polar2cartesian", "cartesian2polar", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "ord", "str", "print", "printt", "prints", "printerr", "printraw", "print_debug", "push_error", "push_warning", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "get_stack", "instance_from_id", "len", "is_instance_valid"],
+	},
+	"513c026": {
+		"bytecode_version": 11,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_CONST_PI", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "hash", "Color8", "print_stack", "instance_from_id"],
+	},
+	"514a3fb": {
+		"bytecode_version": 13,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_WHILE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_CLASS_NAME", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_AS", "TK_PR_VOID", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_PR_PUPPET", "TK_PR_REMOTESYNC", "TK_PR_MASTERSYNC", "TK_PR_PUPPETSYNC", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_FORWARD_ARROW", "TK_NEWLINE", "TK_CONST_PI", "TK_CONST_TAU", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "inverse_lerp", "range_lerp", "smoothstep", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "polar2cartesian", "cartesian2polar", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "print_debug", "push_error", "push_warning", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "get_stack", "instance_from_id", "len", "is_instance_valid"],
+	},
+	"5565f55": {
+		"bytecode_version": 13,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_WHILE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_CLASS_NAME", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_AS", "TK_PR_VOID", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_PR_PUPPET", "TK_PR_REMOTESYNC", "TK_PR_MASTERSYNC", "TK_PR_PUPPETSYNC", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_FORWARD_ARROW", "TK_NEWLINE", "TK_CONST_PI", "TK_CONST_TAU", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "posmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "is_equal_approx", "is_zero_approx", "ease", "decimals", "step_decimals", "stepify", "lerp", "lerp_angle", "inverse_lerp", "range_lerp", "smoothstep", "move_toward", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "polar2cartesian", "cartesian2polar", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "ord", "str", "print", "printt", "prints", "printerr", "printraw", "print_debug", "push_error", "push_warning", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "get_stack", "instance_from_id", "len", "is_instance_valid"],
+	},
+	"5e938f0": {
+		"bytecode_version": 12,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_NEWLINE", "TK_CONST_PI", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "instance_from_id"],
+	},
+	"6174585": {
+		"bytecode_version": 9,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_CONST_PI", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "range", "load", "inst2dict", "dict2inst", "hash", "Color8", "print_stack", "instance_from_id"],
+	},
+	"620ec47": {
+		"bytecode_version": 13,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_WHILE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_CLASS_NAME", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_AS", "TK_PR_VOID", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_PR_PUPPET", "TK_PR_REMOTESYNC", "TK_PR_MASTERSYNC", "TK_PR_PUPPETSYNC", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_FORWARD_ARROW", "TK_NEWLINE", "TK_CONST_PI", "TK_CONST_TAU", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "is_equal_approx", "is_zero_approx", "ease", "decimals", "step_decimals", "stepify", "lerp", "inverse_lerp", "range_lerp", "smoothstep", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "polar2cartesian", "cartesian2polar", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "print_debug", "push_error", "push_warning", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "get_stack", "instance_from_id", "len", "is_instance_valid"],
+	},
+	"62273e5": {
+		"bytecode_version": 12,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_NEWLINE", "TK_CONST_PI", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "instance_from_id"],
+	},
+	"64872ca": {
+		"bytecode_version": 8,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "range", "load", "inst2dict", "dict2inst", "hash", "Color8", "print_stack", "instance_from_id"],
+	},
+	"65d48d6": {
+		"bytecode_version": 4,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "range", "load", "inst2dict", "dict2inst", "hash", "print_stack", "instance_from_id"],
+	},
+	"6694c11": {
+		"bytecode_version": 13,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_WHILE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_CLASS_NAME", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_AS", "TK_PR_VOID", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_PR_PUPPET", "TK_PR_REMOTESYNC", "TK_PR_MASTERSYNC", "TK_PR_PUPPETSYNC", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_FORWARD_ARROW", "TK_NEWLINE", "TK_CONST_PI", "TK_CONST_TAU", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "posmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "is_equal_approx", "is_zero_approx", "ease", "decimals", "step_decimals", "stepify", "lerp", "lerp_angle", "inverse_lerp", "range_lerp", "smoothstep", "move_toward", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "polar2cartesian", "cartesian2polar", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "print_debug", "push_error", "push_warning", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "get_stack", "instance_from_id", "len", "is_instance_valid"],
+	},
+	"703004f": {
+		"bytecode_version": 2,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_ERROR", "TK_EOF"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "str", "print", "printt", "printerr", "printraw", "range", "load", "inst2dict", "dict2inst", "hash", "print_stack"],
+	},
+	"7124599": {
+		"bytecode_version": 10,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_CONST_PI", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "hash", "Color8", "print_stack", "instance_from_id"],
+	},
+	"7d2d144": {
+		"bytecode_version": 7,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "range", "load", "inst2dict", "dict2inst", "hash", "print_stack", "instance_from_id"],
+	},
+	"7f7d97f": {
+		"bytecode_version": 13,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_WHILE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_CLASS_NAME", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_AS", "TK_PR_VOID", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_PR_PUPPET", "TK_PR_REMOTESYNC", "TK_PR_MASTERSYNC", "TK_PR_PUPPETSYNC", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_FORWARD_ARROW", "TK_NEWLINE", "TK_CONST_PI", "TK_CONST_TAU", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "is_equal_approx", "is_zero_approx", "ease", "decimals", "stepify", "lerp", "inverse_lerp", "range_lerp", "smoothstep", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "polar2cartesian", "cartesian2polar", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "print_debug", "push_error", "push_warning", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "get_stack", "instance_from_id", "len", "is_instance_valid"],
+	},
+	"85585c7": {
+		"bytecode_version": 10,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_CONST_PI", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "hash", "Color8", "ColorN", "print_stack", "instance_from_id"],
+	},
+	"8aab9a0": {
+		"bytecode_version": 13,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_CLASS_NAME", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_AS", "TK_PR_VOID", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_PR_REMOTESYNC", "TK_PR_MASTERSYNC", "TK_PR_SLAVESYNC", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_FORWARD_ARROW", "TK_NEWLINE", "TK_CONST_PI", "TK_CONST_TAU", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "inverse_lerp", "range_lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "polar2cartesian", "cartesian2polar", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "print_debug", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "get_stack", "instance_from_id", "len", "is_instance_valid"],
+	},
+	"8b912d1": {
+		"bytecode_version": 11,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_NEWLINE", "TK_CONST_PI", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "hash", "Color8", "ColorN", "print_stack", "instance_from_id"],
+	},
+	"8c1731b": {
+		"bytecode_version": 2,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_ERROR", "TK_EOF"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "convert", "typeof", "str", "print", "printt", "printerr", "printraw", "range", "load", "inst2dict", "dict2inst", "print_stack"],
+	},
+	"8cab401": {
+		"bytecode_version": 2,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_ERROR", "TK_EOF"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "str", "print", "printt", "printerr", "printraw", "range", "load", "inst2dict", "dict2inst", "hash", "print_stack"],
+	},
+	"8e35d93": {
+		"bytecode_version": 12,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_PR_REMOTESYNC", "TK_PR_MASTERSYNC", "TK_PR_SLAVESYNC", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_NEWLINE", "TK_CONST_PI", "TK_CONST_TAU", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "inverse_lerp", "range_lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "polar2cartesian", "cartesian2polar", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "print_debug", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "get_stack", "instance_from_id", "len", "is_instance_valid"],
+	},
+	"91ca725": {
+		"bytecode_version": 12,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_NEWLINE", "TK_CONST_PI", "TK_CONST_TAU", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "inverse_lerp", "range_lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "instance_from_id", "len"],
+	},
+	"97f34a1": {
+		"bytecode_version": 3,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "str", "print", "printt", "printerr", "printraw", "var2str", "str2var", "range", "load", "inst2dict", "dict2inst", "hash", "print_stack", "get_inst"],
+	},
+	"a3f1ee5": {
+		"bytecode_version": 13,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_CLASS_NAME", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_PR_REMOTESYNC", "TK_PR_MASTERSYNC", "TK_PR_SLAVESYNC", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_NEWLINE", "TK_CONST_PI", "TK_CONST_TAU", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "inverse_lerp", "range_lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "polar2cartesian", "cartesian2polar", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "print_debug", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "get_stack", "instance_from_id", "len", "is_instance_valid"],
+	},
+	"a56d6ff": {
+		"bytecode_version": 12,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_NEWLINE", "TK_CONST_PI", "TK_CONST_TAU", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "inverse_lerp", "range_lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "polar2cartesian", "cartesian2polar", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "get_stack", "instance_from_id", "len", "is_instance_valid"],
+	},
+	"a60f242": {
+		"bytecode_version": 13,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_WHILE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_CLASS_NAME", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_AS", "TK_PR_VOID", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_PR_PUPPET", "TK_PR_REMOTESYNC", "TK_PR_MASTERSYNC", "TK_PR_PUPPETSYNC", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_FORWARD_ARROW", "TK_NEWLINE", "TK_CONST_PI", "TK_CONST_TAU", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "posmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "is_equal_approx", "is_zero_approx", "ease", "decimals", "step_decimals", "stepify", "lerp", "inverse_lerp", "range_lerp", "smoothstep", "move_toward", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "polar2cartesian", "cartesian2polar", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "print_debug", "push_error", "push_warning", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "get_stack", "instance_from_id", "len", "is_instance_valid"],
+	},
+	"a7aad78": {
+		"bytecode_version": 13,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_WHILE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_CLASS_NAME", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_AS", "TK_PR_VOID", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_PR_PUPPET", "TK_PR_REMOTESYNC", "TK_PR_MASTERSYNC", "TK_PR_PUPPETSYNC", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_FORWARD_ARROW", "TK_NEWLINE", "TK_CONST_PI", "TK_CONST_TAU", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "posmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "is_equal_approx", "is_zero_approx", "ease", "decimals", "step_decimals", "stepify", "lerp", "lerp_angle", "inverse_lerp", "range_lerp", "smoothstep", "move_toward", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "polar2cartesian", "cartesian2polar", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "ord", "str", "print", "printt", "prints", "printerr", "printraw", "print_debug", "push_error", "push_warning", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "get_stack", "instance_from_id", "len", "is_instance_valid", "deep_equal"],
+	},
+	"be46be7": {
+		"bytecode_version": 3,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "str", "print", "printt", "printerr", "printraw", "var2str", "str2var", "range", "load", "inst2dict", "dict2inst", "hash", "print_stack", "instance_from_id"],
+	},
+	"c00427a": {
+		"bytecode_version": 13,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_WHILE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_CLASS_NAME", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_AS", "TK_PR_VOID", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_PR_PUPPET", "TK_PR_REMOTESYNC", "TK_PR_MASTERSYNC", "TK_PR_PUPPETSYNC", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_FORWARD_ARROW", "TK_NEWLINE", "TK_CONST_PI", "TK_CONST_TAU", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "is_equal_approx", "is_zero_approx", "ease", "decimals", "step_decimals", "stepify", "lerp", "inverse_lerp", "range_lerp", "smoothstep", "move_toward", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "polar2cartesian", "cartesian2polar", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "print_debug", "push_error", "push_warning", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "get_stack", "instance_from_id", "len", "is_instance_valid"],
+	},
+	"c24c739": {
+		"bytecode_version": 12,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_NEWLINE", "TK_CONST_PI", "TK_WILDCARD", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "instance_from_id"],
+	},
+	"c6120e7": {
+		"bytecode_version": 12,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_NEWLINE", "TK_CONST_PI", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "instance_from_id", "len"],
+	},
+	"d28da86": {
+		"bytecode_version": 12,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_NEWLINE", "TK_CONST_PI", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "inverse_lerp", "range_lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "instance_from_id", "len"],
+	},
+	"d6b31da": {
+		"bytecode_version": 13,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_CLASS_NAME", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_AS", "TK_PR_VOID", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_PR_PUPPET", "TK_PR_REMOTESYNC", "TK_PR_MASTERSYNC", "TK_PR_PUPPETSYNC", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_FORWARD_ARROW", "TK_NEWLINE", "TK_CONST_PI", "TK_CONST_TAU", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "inverse_lerp", "range_lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "polar2cartesian", "cartesian2polar", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "print_debug", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "get_stack", "instance_from_id", "len", "is_instance_valid"],
+	},
+	"e82dc40": {
+		"bytecode_version": 3,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_ERROR", "TK_EOF"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "str", "print", "printt", "printerr", "printraw", "range", "load", "inst2dict", "dict2inst", "hash", "print_stack"],
+	},
+	"ed80f45": {
+		"bytecode_version": 10,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_NEWLINE", "TK_CONST_PI", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "hash", "Color8", "ColorN", "print_stack", "instance_from_id"],
+	},
+	"f3f05dc": {
+		"bytecode_version": 13,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_WHILE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_CLASS_NAME", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_AS", "TK_PR_VOID", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_MASTER", "TK_PR_PUPPET", "TK_PR_REMOTESYNC", "TK_PR_MASTERSYNC", "TK_PR_PUPPETSYNC", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_FORWARD_ARROW", "TK_NEWLINE", "TK_CONST_PI", "TK_CONST_TAU", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "posmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "is_equal_approx", "is_zero_approx", "ease", "step_decimals", "stepify", "lerp", "lerp_angle", "inverse_lerp", "range_lerp", "smoothstep", "move_toward", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "polar2cartesian", "cartesian2polar", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "ord", "str", "print", "printt", "prints", "printerr", "printraw", "print_debug", "push_error", "push_warning", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "get_stack", "instance_from_id", "len", "is_instance_valid"],
+	},
+	"f8a7c46": {
+		"bytecode_version": 12,
+		"variant_ver_major": 2,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_NEWLINE", "TK_CONST_PI", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "instance_from_id"],
+	},
+	"ff1e7cf": {
+		"bytecode_version": 12,
+		"variant_ver_major": 3,
+		"tokens": ["TK_EMPTY", "TK_IDENTIFIER", "TK_CONSTANT", "TK_SELF", "TK_BUILT_IN_TYPE", "TK_BUILT_IN_FUNC", "TK_OP_IN", "TK_OP_EQUAL", "TK_OP_NOT_EQUAL", "TK_OP_LESS", "TK_OP_LESS_EQUAL", "TK_OP_GREATER", "TK_OP_GREATER_EQUAL", "TK_OP_AND", "TK_OP_OR", "TK_OP_NOT", "TK_OP_ADD", "TK_OP_SUB", "TK_OP_MUL", "TK_OP_DIV", "TK_OP_MOD", "TK_OP_SHIFT_LEFT", "TK_OP_SHIFT_RIGHT", "TK_OP_ASSIGN", "TK_OP_ASSIGN_ADD", "TK_OP_ASSIGN_SUB", "TK_OP_ASSIGN_MUL", "TK_OP_ASSIGN_DIV", "TK_OP_ASSIGN_MOD", "TK_OP_ASSIGN_SHIFT_LEFT", "TK_OP_ASSIGN_SHIFT_RIGHT", "TK_OP_ASSIGN_BIT_AND", "TK_OP_ASSIGN_BIT_OR", "TK_OP_ASSIGN_BIT_XOR", "TK_OP_BIT_AND", "TK_OP_BIT_OR", "TK_OP_BIT_XOR", "TK_OP_BIT_INVERT", "TK_CF_IF", "TK_CF_ELIF", "TK_CF_ELSE", "TK_CF_FOR", "TK_CF_DO", "TK_CF_WHILE", "TK_CF_SWITCH", "TK_CF_CASE", "TK_CF_BREAK", "TK_CF_CONTINUE", "TK_CF_PASS", "TK_CF_RETURN", "TK_CF_MATCH", "TK_PR_FUNCTION", "TK_PR_CLASS", "TK_PR_EXTENDS", "TK_PR_IS", "TK_PR_ONREADY", "TK_PR_TOOL", "TK_PR_STATIC", "TK_PR_EXPORT", "TK_PR_SETGET", "TK_PR_CONST", "TK_PR_VAR", "TK_PR_ENUM", "TK_PR_PRELOAD", "TK_PR_ASSERT", "TK_PR_YIELD", "TK_PR_SIGNAL", "TK_PR_BREAKPOINT", "TK_PR_REMOTE", "TK_PR_SYNC", "TK_PR_MASTER", "TK_PR_SLAVE", "TK_BRACKET_OPEN", "TK_BRACKET_CLOSE", "TK_CURLY_BRACKET_OPEN", "TK_CURLY_BRACKET_CLOSE", "TK_PARENTHESIS_OPEN", "TK_PARENTHESIS_CLOSE", "TK_COMMA", "TK_SEMICOLON", "TK_PERIOD", "TK_QUESTION_MARK", "TK_COLON", "TK_DOLLAR", "TK_NEWLINE", "TK_CONST_PI", "TK_CONST_TAU", "TK_WILDCARD", "TK_CONST_INF", "TK_CONST_NAN", "TK_ERROR", "TK_EOF", "TK_CURSOR"],
+		"funcs": ["sin", "cos", "tan", "sinh", "cosh", "tanh", "asin", "acos", "atan", "atan2", "sqrt", "fmod", "fposmod", "floor", "ceil", "round", "abs", "sign", "pow", "log", "exp", "is_nan", "is_inf", "ease", "decimals", "stepify", "lerp", "inverse_lerp", "range_lerp", "dectime", "randomize", "randi", "randf", "rand_range", "seed", "rand_seed", "deg2rad", "rad2deg", "linear2db", "db2linear", "polar2cartesian", "cartesian2polar", "wrapi", "wrapf", "max", "min", "clamp", "nearest_po2", "weakref", "funcref", "convert", "typeof", "type_exists", "char", "str", "print", "printt", "prints", "printerr", "printraw", "var2str", "str2var", "var2bytes", "bytes2var", "range", "load", "inst2dict", "dict2inst", "validate_json", "parse_json", "to_json", "hash", "Color8", "ColorN", "print_stack", "instance_from_id", "len", "is_instance_valid"],
+	},
+}
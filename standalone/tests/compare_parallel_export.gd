@@ -0,0 +1,148 @@
+extends SceneTree
+
+# Checks that exporting a pack with multiple jobs produces the same files and the same export report as
+# exporting it with a single job.
+# By default a synthetic Godot 4 project (textures, samples, auto-converted resources and imports that can't be
+# converted) is packed with PckCreator and used; --pck recovers an existing pack instead.
+# Each pack is recovered twice, once with 1 job and once with the default job count (all available threads),
+# then both output trees are compared file by file.
+# Run with: godot --headless --path standalone --script res://tests/compare_parallel_export.gd -- [--pck=<PCK>] [--key=<KEY>] [--output-dir=<DIR>]
+
+const Common = preload("res://tests/test_common.gd")
+
+func get_arg_value(arg: String) -> String:
+	return arg.substr(arg.find("=") + 1)
+
+func import_file(source: String, importer: String, type: String, dest: String) -> PackedByteArray:
+	var text = "[remap]\n\nimporter=\"%s\"\ntype=\"%s\"\npath=\"%s\"\n\n" % [importer, type, dest]
+	text += "[deps]\n\nsource_file=\"%s\"\ndest_files=[\"%s\"]\n\n[params]\n\ncompress/mode=0\n" % [source, dest]
+	return text.to_utf8_buffer()
+
+func imported_path(source: String, ext: String) -> String:
+	return "res://.godot/imported/" + source.get_file() + "-" + source.md5_text() + "." + ext
+
+# CompressedTexture2D (.ctex) holding an uncompressed image
+func make_ctex(img: Image) -> PackedByteArray:
+	var buf = StreamPeerBuffer.new()
+	buf.put_data("GST2".to_ascii_buffer())
+	buf.put_32(1) # format version
+	for i in range(7):
+		buf.put_32(0) # custom size, flags, mipmap limit, reserved
+	buf.put_32(0) # DATA_FORMAT_IMAGE
+	buf.put_16(img.get_width())
+	buf.put_16(img.get_height())
+	buf.put_32(0) # mipmaps
+	buf.put_32(img.get_format())
+	buf.put_data(img.get_data())
+	return buf.data_array
+
+func save_resource(res: Resource, dir: String, res_path: String) -> int:
+	var path = dir.path_join(res_path.replace("res://", ""))
+	DirAccess.make_dir_recursive_absolute(path.get_base_dir())
+	return ResourceSaver.save(res, path)
+
+func make_fixture(dir: String) -> int:
+	var rng = RandomNumberGenerator.new()
+	rng.seed = 0x1
+	for i in range(48):
+		var source = "res://textures/tex_%d.png" % i
+		var img = Image.create_from_data(16, 16, false, Image.FORMAT_RGBA8, Common.random_bytes(rng, 16 * 16 * 4))
+		Common.write_file(dir.path_join(imported_path(source, "ctex").replace("res://", "")), make_ctex(img))
+		Common.write_file(dir.path_join(source.replace("res://", "") + ".import"), import_file(source, "texture", "CompressedTexture2D", imported_path(source, "ctex")))
+	for i in range(12):
+		var source = "res://sounds/snd_%d.wav" % i
+		var sample = AudioStreamWAV.new()
+		sample.format = AudioStreamWAV.FORMAT_16_BITS
+		sample.mix_rate = 22050
+		sample.data = Common.random_bytes(rng, 2000 + i * 2)
+		if save_resource(sample, dir, imported_path(source, "sample")) != OK:
+			return ERR_CANT_CREATE
+		Common.write_file(dir.path_join(source.replace("res://", "") + ".import"), import_file(source, "wav", "AudioStreamWAV", imported_path(source, "sample")))
+	for i in range(12):
+		# text resources that were converted to binary on export
+		var source = "res://resources/gradient_%d.tres" % i
+		var exported = "res://.godot/exported/133200997/export-" + source.md5_text() + "-gradient_%d.res" % i
+		var gradient = Gradient.new()
+		gradient.offsets = PackedFloat32Array([0.0, rng.randf(), 1.0])
+		gradient.colors = PackedColorArray([Color(rng.randf(), 0, 0), Color(0, rng.randf(), 0), Color(0, 0, rng.randf())])
+		if save_resource(gradient, dir, exported) != OK:
+			return ERR_CANT_CREATE
+		Common.write_file(dir.path_join(source.replace("res://", "") + ".remap"), ("[remap]\n\npath=\"%s\"\n" % exported).to_utf8_buffer())
+	for i in range(4):
+		# not convertible, these end up in the report's unsupported types
+		var scene_source = "res://models/model_%d.glb" % i
+		var scene = PackedScene.new()
+		var node = Node3D.new()
+		scene.pack(node)
+		node.free()
+		if save_resource(scene, dir, imported_path(scene_source, "scn")) != OK:
+			return ERR_CANT_CREATE
+		Common.write_file(dir.path_join(scene_source.replace("res://", "") + ".import"), import_file(scene_source, "scene", "PackedScene", imported_path(scene_source, "scn")))
+		var mesh_source = "res://models/mesh_%d.obj" % i
+		var mesh = ArrayMesh.new()
+		var arrays = []
+		arrays.resize(Mesh.ARRAY_MAX)
+		arrays[Mesh.ARRAY_VERTEX] = PackedVector3Array([Vector3(0, 0, 0), Vector3(1, 0, 0), Vector3(0, 1, i)])
+		mesh.add_surface_from_arrays(Mesh.PRIMITIVE_TRIANGLES, arrays)
+		if save_resource(mesh, dir, imported_path(mesh_source, "mesh")) != OK:
+			return ERR_CANT_CREATE
+		Common.write_file(dir.path_join(mesh_source.replace("res://", "") + ".import"), import_file(mesh_source, "wavefront_obj", "Mesh", imported_path(mesh_source, "mesh")))
+	return OK
+
+# Returns the export report, or an empty string if the export failed
+func recover(pck: String, key: String, output_dir: String, num_jobs: int) -> String:
+	if key != "":
+		if GDRESettings.set_encryption_key_string(key) != OK:
+			print("Error: failed to set key!")
+			return ""
+	var err = GDRESettings.load_pack(pck)
+	if err != OK:
+		print("Error: failed to open " + pck)
+		return ""
+	var pckdump = PckDumper.new()
+	pckdump.set_num_jobs(num_jobs)
+	err = pckdump.pck_dump_to_dir(output_dir)
+	var report = ""
+	if err == OK:
+		var importer: ImportExporter = ImportExporter.new()
+		importer.set_num_jobs(num_jobs)
+		err = importer.export_imports(output_dir)
+		report = importer.get_report() + importer.get_session_notes()
+		importer.reset()
+	GDRESettings.unload_pack()
+	return report if err == OK else ""
+
+func _init():
+	var pck = ""
+	var key = ""
+	var output_dir = OS.get_user_data_dir().path_join("compare_parallel_export")
+	for arg in OS.get_cmdline_user_args():
+		if arg.begins_with("--pck="):
+			pck = get_arg_value(arg)
+		elif arg.begins_with("--key="):
+			key = get_arg_value(arg)
+		elif arg.begins_with("--output-dir="):
+			output_dir = get_arg_value(arg)
+	for d in ["serial", "parallel", "fixture"]:
+		Common.remove_dir(output_dir.path_join(d))
+	if pck == "":
+		var fixture_dir = output_dir.path_join("fixture")
+		pck = output_dir.path_join("fixture.pck")
+		if make_fixture(fixture_dir) != OK or Common.create_pck(fixture_dir, pck, 2, "4.0.0") != OK:
+			print("Error: failed to create the fixture pack")
+			quit(1)
+			return
+	var serial_dir = output_dir.path_join("serial")
+	var parallel_dir = output_dir.path_join("parallel")
+	var serial_report = recover(pck, key, serial_dir, 1)
+	var parallel_report = recover(pck, key, parallel_dir, -1)
+	if serial_report.is_empty() or parallel_report.is_empty():
+		print("Error: failed to export " + pck)
+		quit(1)
+		return
+	var differences = Common.compare_trees(serial_dir, parallel_dir)
+	if serial_report != parallel_report:
+		print("DIFFERS: export report")
+		differences += 1
+	print("Parallel export: " + str(Common.list_files(serial_dir).size()) + " files, " + str(differences) + " differences")
+	quit(1 if differences > 0 else 0)
@@ -0,0 +1,187 @@
+extends SceneTree
+
+# Converts binary resources holding 0, -0, nan, +-inf and numbers with large and small exponents (as scalars, vectors
+# and in every packed array type), a non-ASCII string and a packed array larger than the text writer's buffer to text
+# through ImportExporter, and compares every property line with the output before text was streamed through
+# TextFileWriterCompat. Godot 2 and 3 binaries are made from text with convert_res_txt_2_bin() and their expected
+# lines use a GDScript port of the old rtosfix() formatting; Godot 4 binaries are saved by the engine and their
+# lines are formatted by the engine's VariantWriter, which the converter uses for them.
+# Run with: godot --headless --path standalone --script res://tests/test_bin_to_txt_numbers.gd
+
+const Common = preload("res://tests/test_common.gd")
+
+const VALUES = [0.0, -0.0, NAN, INF, -INF, 3.0e38, -3.0e38, 1.17549435e-38, 1.4e-45, 1.0e-5, 123456789.0, 0.1, -2.5, 1.0, 100000.0, 1000000.0]
+const TEXT = "héllo wörld ✓ 日本語"
+const NUM_LARGE = 100000
+
+# values as they are stored in a binary resource with 32-bit reals
+func f32(v: float) -> float:
+	return PackedFloat32Array([v])[0]
+
+func token(v: float) -> String:
+	if is_nan(v):
+		return "nan"
+	elif is_inf(v):
+		return "inf" if v > 0 else "inf_neg"
+	elif v == 0.0:
+		return "-0.0" if str(v).begins_with("-") else "0.0"
+	return String.num_scientific(v)
+
+# the value the text parser reads back for a token, rounded to 32 bits
+func parsed(v: float) -> float:
+	if is_nan(v) or is_inf(v) or v == 0.0:
+		return v
+	return f32(token(v).to_float())
+
+# rtosfix() before the packed writer: zero without a sign, everything else through String::num_scientific()
+func rtosfix(v: float) -> String:
+	if v == 0.0:
+		return "0"
+	return String.num_scientific(v)
+
+func join_tokens(values: Array) -> String:
+	var parts = PackedStringArray()
+	for v in values:
+		parts.append(token(v))
+	return ", ".join(parts)
+
+func join_old(values: Array) -> String:
+	var parts = PackedStringArray()
+	for v in values:
+		parts.append(rtosfix(parsed(v)))
+	return ", ".join(parts)
+
+# property -> [text written to the source resource, expected line in the converted resource]
+func make_v3_properties(ver_major: int, large: Array) -> Dictionary:
+	var names = {
+		"ByteArray": "ByteArray" if ver_major == 2 else "PoolByteArray",
+		"IntArray": "IntArray" if ver_major == 2 else "PoolIntArray",
+		"FloatArray": "FloatArray" if ver_major == 2 else "PoolRealArray",
+		"Vector2Array": "Vector2Array" if ver_major == 2 else "PoolVector2Array",
+		"Vector3Array": "Vector3Array" if ver_major == 2 else "PoolVector3Array",
+		"ColorArray": "ColorArray" if ver_major == 2 else "PoolColorArray",
+	}
+	var props = {}
+	for i in range(VALUES.size()):
+		var v = VALUES[i]
+		# scalars that end up without a '.' or an exponent got ".0" appended
+		var s = rtosfix(parsed(v))
+		if s.find(".") == -1 and s.find("e") == -1:
+			s += ".0"
+		props["real_%d" % i] = [token(v), s]
+	var vec = [VALUES[3], VALUES[8], VALUES[1]]
+	props["vector3"] = ["Vector3( %s )" % join_tokens(vec), "Vector3( %s )" % join_old(vec)]
+	var ints = "0, -1, 2147483647, -2147483648, 65536"
+	props["ints"] = ["%s( %s )" % [names["IntArray"], ints], "%s( %s )" % [names["IntArray"], ints]]
+	props["bytes"] = ["%s( 0, 1, 127, 128, 255 )" % names["ByteArray"], "%s( 0, 1, 127, 128, 255 )" % names["ByteArray"]]
+	for type in ["FloatArray", "Vector2Array", "Vector3Array", "ColorArray"]:
+		var width = {"FloatArray": 1, "Vector2Array": 2, "Vector3Array": 3, "ColorArray": 4}[type]
+		var values = []
+		for i in range(VALUES.size() * width):
+			values.append(value_at(i))
+		props[type.to_lower()] = ["%s( %s )" % [names[type], join_tokens(values)], "%s( %s )" % [names[type], join_old(values)]]
+	props["large"] = ["%s( %s )" % [names["FloatArray"], join_tokens(large)], "%s( %s )" % [names["FloatArray"], join_old(large)]]
+	props["text"] = ["\"" + TEXT + "\"", "\"" + TEXT + "\""]
+	return props
+
+func value_at(i: int) -> float:
+	return VALUES[i % VALUES.size()]
+
+func make_v4_properties(large: Array) -> Dictionary:
+	var props = {}
+	for i in range(VALUES.size()):
+		props["real_%d" % i] = VALUES[i]
+	props["vector3"] = Vector3(VALUES[3], VALUES[8], VALUES[1])
+	props["ints"] = PackedInt32Array([0, -1, 2147483647, -2147483648, 65536])
+	props["int64s"] = PackedInt64Array([0, -1, 9223372036854775807, -9223372036854775807 - 1])
+	props["bytes"] = PackedByteArray([0, 1, 127, 128, 255])
+	props["floatarray"] = PackedFloat32Array(VALUES)
+	props["float64array"] = PackedFloat64Array(VALUES)
+	var vec2 = PackedVector2Array()
+	var vec3 = PackedVector3Array()
+	var colors = PackedColorArray()
+	for i in range(VALUES.size()):
+		vec2.append(Vector2(value_at(i), value_at(i + 1)))
+		vec3.append(Vector3(value_at(i), value_at(i + 1), value_at(i + 2)))
+		colors.append(Color(value_at(i), value_at(i + 1), value_at(i + 2), value_at(i + 3)))
+	props["vector2array"] = vec2
+	props["vector3array"] = vec3
+	props["colorarray"] = colors
+	props["large"] = PackedFloat32Array(large)
+	props["text"] = TEXT
+	return props
+
+func check_lines(name: String, converted: String, expected: Dictionary) -> int:
+	var failed = 0
+	var lines = {}
+	for line in FileAccess.get_file_as_string(converted).split("\n"):
+		var sep = line.find(" = ")
+		if sep > 0:
+			lines[line.substr(0, sep)] = line.substr(sep + 3)
+	for prop in expected:
+		if not lines.has(prop):
+			print("FAIL: " + name + ": " + prop + " is missing")
+			failed += 1
+		elif lines[prop] != expected[prop]:
+			var actual: String = lines[prop]
+			print("FAIL: " + name + ": " + prop + " is\n\t" + actual.left(200) + "\nexpected\n\t" + expected[prop].left(200))
+			failed += 1
+	return failed
+
+func run_v2_v3(ver_major: int, out_dir: String, large: Array) -> int:
+	var name = "v" + str(ver_major)
+	var importer = ImportExporter.new()
+	var props = make_v3_properties(ver_major, large)
+	var source = out_dir.path_join(name + ".tres")
+	var bin = out_dir.path_join(name + ".res")
+	var converted = out_dir.path_join(name + "_converted.tres")
+	var text = "[gd_resource type=\"Resource\" format=%d]\n\n[resource]\n" % (ver_major - 1)
+	var expected = {}
+	for prop in props:
+		text += prop + " = " + props[prop][0] + "\n"
+		expected[prop] = props[prop][1]
+	Common.write_file(source, text.to_utf8_buffer())
+	if importer.convert_res_txt_2_bin("", source, bin) != OK:
+		print("FAIL: " + name + ": txt->bin failed")
+		return 1
+	var start = Time.get_ticks_msec()
+	if importer.convert_res_bin_2_txt("", bin, converted) != OK:
+		print("FAIL: " + name + ": bin->txt failed")
+		return 1
+	print(name + ": converted to text in " + str(Time.get_ticks_msec() - start) + " ms")
+	return check_lines(name, converted, expected)
+
+func run_v4(out_dir: String, large: Array) -> int:
+	var importer = ImportExporter.new()
+	var res = Resource.new()
+	var expected = {}
+	var props = make_v4_properties(large)
+	for prop in props:
+		res.set_meta(prop, props[prop])
+		expected["metadata/" + prop] = var_to_str(props[prop])
+	var bin = out_dir.path_join("v4.res")
+	var converted = out_dir.path_join("v4_converted.tres")
+	if ResourceSaver.save(res, bin) != OK:
+		print("FAIL: v4: could not save the binary resource")
+		return 1
+	if importer.convert_res_bin_2_txt("", bin, converted) != OK:
+		print("FAIL: v4: bin->txt failed")
+		return 1
+	return check_lines("v4", converted, expected)
+
+func _init():
+	var out_dir = OS.get_user_data_dir().path_join("test_bin_to_txt_numbers")
+	Common.remove_dir(out_dir)
+	DirAccess.make_dir_recursive_absolute(out_dir)
+	var rng = RandomNumberGenerator.new()
+	rng.seed = 0x19
+	# spans several flushes of the 64 KiB text buffer
+	var large = []
+	for i in range(NUM_LARGE):
+		large.append(f32(rng.randf_range(-1.0, 1.0) * pow(10.0, rng.randi_range(-30, 30))))
+	var failed = 0
+	failed += run_v2_v3(2, out_dir, large)
+	failed += run_v2_v3(3, out_dir, large)
+	failed += run_v4(out_dir, large)
+	print("Bin to txt numbers: " + str(failed) + " failures")
+	quit(1 if failed > 0 else 0)
@@ -0,0 +1,124 @@
+extends SceneTree
+
+# Converts synthetic Godot 3 (format=2) and Godot 4 (format=3) text resources with 20000 sub-resources to binary and
+# back through ImportExporter, and checks that every sub-resource and external resource reference in the converted
+# text still points at the resource it was generated with. Godot 3 binaries refer to sub-resources by their index
+# and Godot 4 binaries by their named id, so both kinds of internal lookups are covered. Converting the output a
+# second time must give the same text. Also prints how long each bin->txt conversion takes.
+# Run with: godot --headless --path standalone --script res://tests/test_bin_to_txt_subresources.gd
+
+const Common = preload("res://tests/test_common.gd")
+
+const NUM_SUB_RESOURCES = 20000
+const NUM_EXT_RESOURCES = 50
+
+func ref(kind: String, id: int, format: int) -> String:
+	return kind + ("(\"%d\")" % id if format == 3 else "( %d )" % id)
+
+# sub-resource id -> [value, id of the sub-resource it links to or 0, id of the external resource it uses or 0]
+func make_graph(rng: RandomNumberGenerator) -> Dictionary:
+	var graph = {}
+	for id in range(1, NUM_SUB_RESOURCES + 1):
+		# sub-resources can only refer to the ones saved before them
+		var next = rng.randi_range(1, id - 1) if id > 1 else 0
+		var ext = rng.randi_range(1, NUM_EXT_RESOURCES) if id % 5 == 0 else 0
+		graph[id] = [rng.randi_range(0, 1000000), next, ext]
+	return graph
+
+func make_text(graph: Dictionary, format: int) -> String:
+	var lines = PackedStringArray()
+	lines.append("[gd_resource type=\"Resource\" load_steps=%d format=%d]" % [NUM_SUB_RESOURCES + NUM_EXT_RESOURCES + 1, format])
+	lines.append("")
+	for i in range(1, NUM_EXT_RESOURCES + 1):
+		if format == 3:
+			lines.append("[ext_resource type=\"Resource\" path=\"res://ext/ext_%d.tres\" id=\"%d\"]" % [i, i])
+		else:
+			lines.append("[ext_resource path=\"res://ext/ext_%d.tres\" type=\"Resource\" id=%d]" % [i, i])
+	lines.append("")
+	for id in graph:
+		lines.append("[sub_resource type=\"Resource\" id=%s]" % ("\"%d\"" % id if format == 3 else str(id)))
+		lines.append("value = " + str(graph[id][0]))
+		if graph[id][1] > 0:
+			lines.append("next = " + ref("SubResource", graph[id][1], format))
+		if graph[id][2] > 0:
+			lines.append("ext = " + ref("ExtResource", graph[id][2], format))
+		lines.append("")
+	lines.append("[resource]")
+	lines.append("head = " + ref("SubResource", NUM_SUB_RESOURCES, format))
+	lines.append("")
+	return "\n".join(lines)
+
+# reads the graph back from a converted text resource
+func parse_graph(text: String) -> Dictionary:
+	var header = RegEx.create_from_string("^\\[sub_resource type=\"Resource\" id=\"?(\\d+)\"?\\]$")
+	var property = RegEx.create_from_string("^(value|next|ext) = (?:(?:SubResource|ExtResource)\\(\\s*\"?(\\d+)\"?\\s*\\)|(\\d+))$")
+	var graph = {}
+	var current = 0
+	for line in text.split("\n"):
+		var m = header.search(line)
+		if m:
+			current = int(m.get_string(1))
+			graph[current] = [-1, 0, 0]
+			continue
+		if line.begins_with("["):
+			current = 0
+			continue
+		m = property.search(line)
+		if m and current > 0:
+			var value = int(m.get_string(2) if m.get_string(2) != "" else m.get_string(3))
+			graph[current][["value", "next", "ext"].find(m.get_string(1))] = value
+	return graph
+
+func run(name: String, out_dir: String, graph: Dictionary, format: int) -> int:
+	var failed = 0
+	var importer = ImportExporter.new()
+	var source = out_dir.path_join(name + ".tres")
+	var bin = out_dir.path_join(name + ".res")
+	var converted = out_dir.path_join(name + "_converted.tres")
+	var bin_again = out_dir.path_join(name + "_again.res")
+	var converted_again = out_dir.path_join(name + "_again.tres")
+	Common.write_file(source, make_text(graph, format).to_utf8_buffer())
+	if importer.convert_res_txt_2_bin("", source, bin) != OK:
+		print("FAIL: " + name + ": txt->bin failed")
+		return 1
+	var start = Time.get_ticks_msec()
+	if importer.convert_res_bin_2_txt("", bin, converted) != OK:
+		print("FAIL: " + name + ": bin->txt failed")
+		return 1
+	print(name + ": converted " + str(NUM_SUB_RESOURCES) + " sub-resources to text in " + str(Time.get_ticks_msec() - start) + " ms")
+
+	var text = FileAccess.get_file_as_string(converted)
+	var actual = parse_graph(text)
+	if actual.size() != graph.size():
+		print("FAIL: " + name + ": " + str(actual.size()) + " sub-resources were converted, expected " + str(graph.size()))
+		failed += 1
+	for id in graph:
+		if actual.get(id) != graph[id]:
+			print("FAIL: " + name + ": sub-resource " + str(id) + " is " + str(actual.get(id)) + ", expected " + str(graph[id]))
+			failed += 1
+			if failed > 10:
+				break
+	if not text.contains("head = " + ref("SubResource", NUM_SUB_RESOURCES, format)):
+		print("FAIL: " + name + ": the main resource does not refer to the last sub-resource")
+		failed += 1
+
+	if importer.convert_res_txt_2_bin("", converted, bin_again) != OK or importer.convert_res_bin_2_txt("", bin_again, converted_again) != OK:
+		print("FAIL: " + name + ": converting the output again failed")
+		failed += 1
+	elif FileAccess.get_file_as_string(converted_again) != text:
+		print("FAIL: " + name + ": converting the output again gave different text")
+		failed += 1
+	return failed
+
+func _init():
+	var out_dir = OS.get_user_data_dir().path_join("test_bin_to_txt_subresources")
+	Common.remove_dir(out_dir)
+	DirAccess.make_dir_recursive_absolute(out_dir)
+	var rng = RandomNumberGenerator.new()
+	rng.seed = 0x18
+	var graph = make_graph(rng)
+	var failed = 0
+	failed += run("v3", out_dir, graph, 2)
+	failed += run("v4", out_dir, graph, 3)
+	print("Bin to txt sub-resources: " + str(failed) + " failures")
+	quit(1 if failed > 0 else 0)
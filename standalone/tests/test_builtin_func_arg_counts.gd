@@ -0,0 +1,41 @@
+extends SceneTree
+
+# Checks the built-in function arg counts every decompiler precomputes for its revision against the name -> arg count
+# map they were computed from: every function id from bytecode_revision_tables.gd has to have the arg counts of the
+# function with that name, and ids past the end of the table have to be unknown. Also checks the revision specific
+# arg counts of var2bytes, which took a second argument from 3.1.1 on.
+# Run with: godot --headless --path standalone --script res://tests/test_builtin_func_arg_counts.gd
+
+const Tables = preload("res://tests/bytecode_revision_tables.gd")
+
+const UNKNOWN = Vector2i(-1, -1)
+# revision -> arg counts of var2bytes
+const VAR2BYTES = {"1a36141": Vector2i(1, 1), "514a3fb": Vector2i(1, 2), "a7aad78": Vector2i(1, 2)}
+
+func _init():
+	var failed = 0
+	var count = 0
+	for rev in Tables.REVISIONS:
+		var decomp = ClassDB.instantiate("GDScriptDecomp_" + rev)
+		if decomp == null:
+			print("FAIL: " + rev + ": no decompiler for this revision")
+			failed += 1
+			continue
+		var funcs: Array = Tables.REVISIONS[rev].funcs
+		for i in range(funcs.size()):
+			var from_table = decomp.get_function_arg_count(i)
+			var by_name = decomp.get_function_arg_count_by_name(funcs[i])
+			if from_table != by_name:
+				print("FAIL: " + rev + ": " + funcs[i] + " (id " + str(i) + ") takes " + str(from_table) + " arguments, expected " + str(by_name))
+				failed += 1
+			count += 1
+		for id in [-1, funcs.size(), funcs.size() + 100]:
+			if decomp.get_function_arg_count(id) != UNKNOWN:
+				print("FAIL: " + rev + ": id " + str(id) + " is past the end of the table but takes " + str(decomp.get_function_arg_count(id)) + " arguments")
+				failed += 1
+		if VAR2BYTES.has(rev) and decomp.get_function_arg_count(funcs.find("var2bytes")) != VAR2BYTES[rev]:
+			print("FAIL: " + rev + ": var2bytes takes " + str(decomp.get_function_arg_count(funcs.find("var2bytes"))) + " arguments, expected " + str(VAR2BYTES[rev]))
+			failed += 1
+		decomp.free()
+	print("Built-in func arg counts: " + str(Tables.REVISIONS.size()) + " revisions, " + str(count) + " functions, " + str(failed) + " failures")
+	quit(1 if failed > 0 else 0)
@@ -0,0 +1,78 @@
+extends SceneTree
+
+# Golden decompile test: compiles the same small script into the bytecode of every revision, using the token and
+# built-in function ids the per-revision decompilers declared before they were table-driven
+# (bytecode_revision_tables.gd), decompiles it with that revision and compares the text with SCRIPT_TEXT.
+# Run with: godot --headless --path standalone --script res://tests/test_bytecode_decompile.gd
+
+const Common = preload("res://tests/test_common.gd")
+const Tables = preload("res://tests/bytecode_revision_tables.gd")
+
+const IDENTIFIERS = ["Node", "GREETING", "count", "add", "a", "b"]
+const CONSTANTS = [3, "hi"]
+const TOKENS = [
+	"TK_PR_EXTENDS", ["TK_IDENTIFIER", "Node"], ["TK_NEWLINE", 0],
+	"TK_PR_CONST", ["TK_IDENTIFIER", "GREETING"], "TK_OP_ASSIGN", ["TK_CONSTANT", 1], ["TK_NEWLINE", 0],
+	"TK_PR_VAR", ["TK_IDENTIFIER", "count"], "TK_OP_ASSIGN", ["TK_CONSTANT", 0], ["TK_NEWLINE", 0],
+	["TK_NEWLINE", 0],
+	"TK_PR_FUNCTION", ["TK_IDENTIFIER", "add"], "TK_PARENTHESIS_OPEN", ["TK_IDENTIFIER", "a"], "TK_COMMA", ["TK_IDENTIFIER", "b"], "TK_PARENTHESIS_CLOSE", "TK_COLON", ["TK_NEWLINE", 1],
+	"TK_CF_IF", ["TK_IDENTIFIER", "a"], "TK_OP_GREATER", ["TK_IDENTIFIER", "b"], "TK_COLON", ["TK_NEWLINE", 2],
+	"TK_CF_RETURN", ["TK_IDENTIFIER", "a"], "TK_OP_MUL", ["TK_IDENTIFIER", "count"], ["TK_NEWLINE", 1],
+	"TK_CF_ELSE", "TK_COLON", ["TK_NEWLINE", 2],
+	["TK_BUILT_IN_FUNC", "print"], "TK_PARENTHESIS_OPEN", ["TK_IDENTIFIER", "GREETING"], "TK_PARENTHESIS_CLOSE", ["TK_NEWLINE", 2],
+	"TK_CF_PASS", ["TK_NEWLINE", 1],
+	"TK_CF_RETURN", "TK_SELF", "TK_PERIOD", ["TK_IDENTIFIER", "count"], "TK_OP_ADD", "TK_BRACKET_OPEN", ["TK_IDENTIFIER", "b"], "TK_BRACKET_CLOSE", "TK_PERIOD", ["TK_IDENTIFIER", "a"], ["TK_NEWLINE", 0],
+]
+
+const SCRIPT_TEXT = """extends Node
+const GREETING = "hi"
+var count = 3
+
+func add(a, b):
+	if a > b:
+		return a * count
+	else :
+		print(GREETING)
+		pass
+	return self.count + [b].a
+"""
+
+# 1.0 also put a space before "if" and "else" at the start of a line
+const SCRIPT_TEXT_E82DC40 = """extends Node
+const GREETING = "hi"
+var count = 3
+
+func add(a, b):
+	 if a > b:
+		return a * count
+	 else :
+		print(GREETING)
+		pass
+	return self.count + [b].a
+"""
+
+func _init():
+	var out_dir = OS.get_user_data_dir().path_join("test_bytecode_decompile")
+	Common.remove_dir(out_dir)
+	DirAccess.make_dir_recursive_absolute(out_dir)
+	var failed = 0
+	for rev in Tables.REVISIONS:
+		var path = out_dir.path_join(rev + ".gdc")
+		Common.write_file(path, Common.make_gdsc(Tables.REVISIONS[rev], IDENTIFIERS, CONSTANTS, TOKENS))
+		var decomp = ClassDB.instantiate("GDScriptDecomp_" + rev)
+		if decomp == null:
+			print("FAIL: " + rev + ": no decompiler for this revision")
+			failed += 1
+			continue
+		var err = decomp.decompile_byte_code(path)
+		var text = decomp.get_script_text()
+		var expected = SCRIPT_TEXT_E82DC40 if rev == "e82dc40" else SCRIPT_TEXT
+		if err != OK:
+			print("FAIL: " + rev + ": " + decomp.get_error_message())
+			failed += 1
+		elif text != expected:
+			print("FAIL: " + rev + ": decompiled text differs:\n" + text)
+			failed += 1
+		decomp.free()
+	print("Bytecode decompile: " + str(Tables.REVISIONS.size()) + " revisions, " + str(failed) + " failures")
+	quit(1 if failed > 0 else 0)
@@ -0,0 +1,115 @@
+extends SceneTree
+
+# Packs synthetic 2.1 and 3.1 scripts compiled for each release revision those versions had (with the token and
+# built-in function ids from bytecode_revision_tables.gd) and checks that loading the pack detects the revision the
+# scripts were compiled with, through the patch number BytecodeTester makes GDRESettings set. Each pack also holds
+# more than a batch of scripts that every candidate accepts; packs of only those scripts have to fall back to the
+# newest release. Also prints how long loading a pack of 5000 scripts takes when the
+# revision is only known from one of them.
+# Run with: godot --headless --path standalone --script res://tests/test_bytecode_revision_detect.gd
+
+const Common = preload("res://tests/test_common.gd")
+const Tables = preload("res://tests/bytecode_revision_tables.gd")
+
+const NUM_NEUTRAL = 40
+const NUM_BENCHMARK = 5000
+
+# name -> [engine version, revision the scripts are compiled with, identifiers, constants, tokens of the script that
+# tells the revision apart, expected patch number, whether a beta is expected]. The packs claim patch 9, which none
+# of the revisions map to, so an unchanged patch number is a failure.
+const CASES = {
+	# print() is followed by TK_PARENTHESIS_OPEN, which TK_PR_ENUM shifted from the id it has in older revisions
+	"2.1.3-2.1.6": ["2.1.9", "ed80f45", ["E", "A", "x"], [], [
+		"TK_PR_ENUM", ["TK_IDENTIFIER", "E"], "TK_CURLY_BRACKET_OPEN", ["TK_IDENTIFIER", "A"], "TK_CURLY_BRACKET_CLOSE", ["TK_NEWLINE", 0],
+		["TK_BUILT_IN_FUNC", "print"], "TK_PARENTHESIS_OPEN", ["TK_IDENTIFIER", "x"], "TK_PARENTHESIS_CLOSE", ["TK_NEWLINE", 0]], 6, false],
+	# ColorN takes an argument where 2.1.0 had print_stack()
+	"2.1.2": ["2.1.9", "85585c7", [], ["red"], [
+		["TK_BUILT_IN_FUNC", "ColorN"], "TK_PARENTHESIS_OPEN", ["TK_CONSTANT", 0], "TK_PARENTHESIS_CLOSE", ["TK_NEWLINE", 0]], 2, false],
+	# instance_from_id takes an argument where 2.1.2 had print_stack()
+	"2.1.0-2.1.1": ["2.1.9", "7124599", ["x"], [], [
+		["TK_BUILT_IN_FUNC", "instance_from_id"], "TK_PARENTHESIS_OPEN", ["TK_IDENTIFIER", "x"], "TK_PARENTHESIS_CLOSE", ["TK_NEWLINE", 0]], 1, false],
+	# smoothstep shifted every later function: db2linear takes one argument where 3.1.0 had polar2cartesian
+	"3.1.1": ["3.1.9", "514a3fb", ["x"], [], [
+		["TK_BUILT_IN_FUNC", "db2linear"], "TK_PARENTHESIS_OPEN", ["TK_IDENTIFIER", "x"], "TK_PARENTHESIS_CLOSE", ["TK_NEWLINE", 0]], 1, false],
+	"3.1.0": ["3.1.9", "1a36141", ["a", "b"], [], [
+		["TK_BUILT_IN_FUNC", "polar2cartesian"], "TK_PARENTHESIS_OPEN", ["TK_IDENTIFIER", "a"], "TK_COMMA", ["TK_IDENTIFIER", "b"], "TK_PARENTHESIS_CLOSE", ["TK_NEWLINE", 0]], 0, false],
+	# the beta still had DO, CASE and SWITCH before TK_PARENTHESIS_OPEN
+	"3.1-beta": ["3.1.9", "1ca61a3", ["x"], [], [
+		["TK_BUILT_IN_FUNC", "print"], "TK_PARENTHESIS_OPEN", ["TK_IDENTIFIER", "x"], "TK_PARENTHESIS_CLOSE", ["TK_NEWLINE", 0]], 0, true],
+}
+
+# a script without built-in calls, which no candidate can rule out
+func make_neutral(rev: Dictionary, i: int) -> PackedByteArray:
+	var identifiers = ["Node", "value_%d" % i, "other"]
+	var tokens = [
+		"TK_PR_EXTENDS", ["TK_IDENTIFIER", "Node"], ["TK_NEWLINE", 0],
+		"TK_PR_VAR", ["TK_IDENTIFIER", identifiers[1]], "TK_OP_ASSIGN", ["TK_CONSTANT", 0], ["TK_NEWLINE", 0],
+		"TK_PR_VAR", ["TK_IDENTIFIER", "other"], "TK_OP_ASSIGN", ["TK_IDENTIFIER", identifiers[1]], "TK_OP_ADD", ["TK_CONSTANT", 0], ["TK_NEWLINE", 0],
+	]
+	return Common.make_gdsc(rev, identifiers, [i], tokens)
+
+# loads a pack of scripts and checks the version it ends up with
+func check(name: String, pck: String, expected_rev: int, beta: bool) -> int:
+	if GDRESettings.load_pack(pck) != OK:
+		print("FAIL: " + name + ": could not load the pack")
+		return 1
+	var failed = 0
+	var version = GDRESettings.get_version_string()
+	if GDRESettings.get_ver_rev() != expected_rev or version.contains("beta") != beta:
+		print("FAIL: " + name + ": detected version " + version + ", expected patch " + str(expected_rev) + (" beta" if beta else ""))
+		failed += 1
+	GDRESettings.unload_pack()
+	return failed
+
+func _init():
+	var out_dir = OS.get_user_data_dir().path_join("test_bytecode_revision_detect")
+	Common.remove_dir(out_dir)
+	var failed = 0
+	var count = 0
+	for name in CASES:
+		var c = CASES[name]
+		var rev = Tables.REVISIONS[c[1]]
+		var fixture_dir = out_dir.path_join(name)
+		for i in range(NUM_NEUTRAL):
+			Common.write_file(fixture_dir.path_join("scripts/neutral_%d.gdc" % i), make_neutral(rev, i))
+		Common.write_file(fixture_dir.path_join("scripts/detect.gdc"), Common.make_gdsc(rev, c[2], c[3], c[4]))
+		var pck = out_dir.path_join(name + ".pck")
+		if Common.create_pck(fixture_dir, pck, 1, c[0]) != OK:
+			print("FAIL: " + name + ": could not create the pack")
+			failed += 1
+			continue
+		failed += check(name, pck, c[5], c[6])
+		count += 1
+
+	# nothing tells the revisions apart, the newest release of each version is used
+	for ver in [["2.1.9", "ed80f45", 6], ["3.1.9", "514a3fb", 1]]:
+		var name = "neutral_" + ver[0]
+		var fixture_dir = out_dir.path_join(name)
+		for i in range(NUM_NEUTRAL):
+			Common.write_file(fixture_dir.path_join("scripts/neutral_%d.gdc" % i), make_neutral(Tables.REVISIONS[ver[1]], i))
+		var pck = out_dir.path_join(name + ".pck")
+		if Common.create_pck(fixture_dir, pck, 1, ver[0]) != OK:
+			print("FAIL: " + name + ": could not create the pack")
+			failed += 1
+			continue
+		failed += check(name, pck, ver[2], false)
+		count += 1
+
+	# benchmark: print() rules out the beta, but only zz_detect.gdc tells 3.1.0 and 3.1.1 apart
+	var rev = Tables.REVISIONS["514a3fb"]
+	var bench_dir = out_dir.path_join("benchmark")
+	var tokens = [["TK_BUILT_IN_FUNC", "print"], "TK_PARENTHESIS_OPEN", ["TK_IDENTIFIER", "x"], "TK_PARENTHESIS_CLOSE", ["TK_NEWLINE", 0]]
+	for i in range(NUM_BENCHMARK):
+		Common.write_file(bench_dir.path_join("scripts/dir_%d/script_%d.gdc" % [i % 50, i]), Common.make_gdsc(rev, ["x"], [], tokens))
+	Common.write_file(bench_dir.path_join("scripts/zz_detect.gdc"), Common.make_gdsc(rev, CASES["3.1.1"][2], [], CASES["3.1.1"][4]))
+	var bench_pck = out_dir.path_join("benchmark.pck")
+	if Common.create_pck(bench_dir, bench_pck, 1, "3.1.9") != OK:
+		print("FAIL: benchmark: could not create the pack")
+		failed += 1
+	else:
+		var start = Time.get_ticks_msec()
+		failed += check("benchmark", bench_pck, 1, false)
+		print("benchmark: loaded and tested " + str(NUM_BENCHMARK + 1) + " scripts in " + str(Time.get_ticks_msec() - start) + " ms")
+		count += 1
+	print("Bytecode revision detect: " + str(count) + " packs, " + str(failed) + " failures")
+	quit(1 if failed > 0 else 0)
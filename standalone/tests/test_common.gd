@@ -0,0 +1,233 @@
+extends RefCounted
+
+# Helpers shared by the headless test scripts in this directory.
+# Use with: const Common = preload("res://tests/test_common.gd")
+
+static func write_file(path: String, data: PackedByteArray) -> int:
+	DirAccess.make_dir_recursive_absolute(path.get_base_dir())
+	var f = FileAccess.open(path, FileAccess.WRITE)
+	if f == null:
+		print("Error: failed to write " + path)
+		return FileAccess.get_open_error()
+	f.store_buffer(data)
+	return OK
+
+static func random_bytes(rng: RandomNumberGenerator, size: int) -> PackedByteArray:
+	var data = PackedByteArray()
+	data.resize(size)
+	for i in range(size):
+		data[i] = rng.randi_range(0, 255)
+	return data
+
+static func remove_dir(dir: String):
+	if not DirAccess.dir_exists_absolute(dir):
+		return
+	for f in DirAccess.get_files_at(dir):
+		DirAccess.remove_absolute(dir.path_join(f))
+	for d in DirAccess.get_directories_at(dir):
+		remove_dir(dir.path_join(d))
+	DirAccess.remove_absolute(dir)
+
+# Lists the files under dir, relative to it, in a stable order
+static func list_files(dir: String, rel: String = "") -> PackedStringArray:
+	var files = PackedStringArray()
+	var base = dir.path_join(rel)
+	for f in DirAccess.get_files_at(base):
+		files.append(rel.path_join(f))
+	for d in DirAccess.get_directories_at(base):
+		files.append_array(list_files(dir, rel.path_join(d)))
+	files.sort()
+	return files
+
+# Compares two directory trees file by file, prints every difference and returns how many there were
+static func compare_trees(expected_dir: String, actual_dir: String) -> int:
+	var expected_files = list_files(expected_dir)
+	var actual_files = list_files(actual_dir)
+	var differences = 0
+	for f in expected_files:
+		if not actual_files.has(f):
+			print("MISSING: " + f)
+			differences += 1
+		elif FileAccess.get_md5(expected_dir.path_join(f)) != FileAccess.get_md5(actual_dir.path_join(f)):
+			print("DIFFERS: " + f)
+			differences += 1
+	for f in actual_files:
+		if not expected_files.has(f):
+			print("UNEXPECTED: " + f)
+			differences += 1
+	return differences
+
+# Packs a directory with PckCreator, files matching encrypt_filters are encrypted with the key set in GDRESettings
+static func create_pck(input_dir: String, output_pck: String, pack_version: int, engine_version: String, embed_source: String = "", encrypt_filters: PackedStringArray = PackedStringArray()) -> int:
+	var ver = engine_version.split(".")
+	var creator = PckCreator.new()
+	creator.set_pack_version(pack_version)
+	creator.set_ver_major(int(ver[0]))
+	creator.set_ver_minor(int(ver[1]))
+	creator.set_ver_rev(int(ver[2]) if ver.size() > 2 else 0)
+	creator.set_embed_source(embed_source)
+	creator.set_encrypt_include_filters(encrypt_filters)
+	return creator.pck_create(output_pck, input_dir)
+
+# Checks that every file under fixture_dir can be read back from the loaded pack with the same contents
+static func check_pack_contents(fixture_dir: String) -> int:
+	var failed = 0
+	var files = list_files(fixture_dir)
+	var packed = GDRESettings.get_file_list()
+	if packed.size() != files.size():
+		print("FAIL: pack lists " + str(packed.size()) + " files, expected " + str(files.size()))
+		failed += 1
+	for f in files:
+		var res_path = "res://" + f
+		if not GDRESettings.has_file(res_path):
+			print("FAIL: " + res_path + " is missing from the pack")
+			failed += 1
+		elif FileAccess.get_file_as_bytes(res_path) != FileAccess.get_file_as_bytes(fixture_dir.path_join(f)):
+			print("FAIL: " + res_path + " has the wrong contents")
+			failed += 1
+	return failed
+
+# CompressedTexture2D (.ctex) holding raw image data, or a PNG if png is set
+static func make_ctex(img: Image, png: bool) -> PackedByteArray:
+	var buf = StreamPeerBuffer.new()
+	buf.put_data("GST2".to_ascii_buffer())
+	buf.put_32(1) # format version
+	for i in range(7):
+		buf.put_32(0) # custom size, flags, mipmap limit, reserved
+	buf.put_32(1 if png else 0) # data format: PNG or raw image
+	buf.put_16(img.get_width())
+	buf.put_16(img.get_height())
+	buf.put_32(img.get_mipmap_count())
+	buf.put_32(img.get_format())
+	if png:
+		var data = img.save_png_to_buffer()
+		buf.put_32(data.size())
+		buf.put_data(data)
+	else:
+		buf.put_data(img.get_data())
+	return buf.data_array
+
+# Builds a compiled GDScript (GDSC) buffer for a revision from bytecode_revision_tables.gd.
+# tokens are token names ("TK_COLON"), or [name, argument] for tokens that carry one: the identifier for
+# TK_IDENTIFIER, the index in constants for TK_CONSTANT, the function name for TK_BUILT_IN_FUNC and the indent of
+# the next line for TK_NEWLINE. constants can be ints and Strings.
+static func make_gdsc(rev: Dictionary, identifiers: Array, constants: Array, tokens: Array) -> PackedByteArray:
+	var token_values = PackedInt32Array()
+	var lines = [[0, 1]]
+	for t in tokens:
+		var name = t if t is String else t[0]
+		var id = rev.tokens.find(name)
+		assert(id >= 0, name + " is not a token of this revision")
+		var arg = 0
+		if not t is String:
+			match name:
+				"TK_IDENTIFIER":
+					arg = identifiers.find(t[1])
+				"TK_BUILT_IN_FUNC":
+					arg = rev.funcs.find(t[1])
+				_:
+					arg = t[1]
+			assert(arg >= 0, str(t[1]) + " was not found")
+		token_values.append(id | (arg << 8))
+		if name == "TK_NEWLINE":
+			lines.append([token_values.size(), lines.size() + 1])
+
+	var buf = StreamPeerBuffer.new()
+	buf.put_data("GDSC".to_ascii_buffer())
+	buf.put_32(rev.bytecode_version)
+	buf.put_32(identifiers.size())
+	buf.put_32(constants.size())
+	buf.put_32(lines.size())
+	buf.put_32(token_values.size())
+	for ident in identifiers:
+		# null terminated, padded to 4 bytes and XOR'd with 0xb6
+		var data = ident.to_utf8_buffer()
+		data.resize(data.size() + 1 + (4 - (data.size() + 1) % 4) % 4)
+		buf.put_32(data.size())
+		for b in data:
+			buf.put_u8(b ^ 0xb6)
+	for c in constants:
+		if c is int:
+			buf.put_32(2) # INT, the same in v2 and v3 variants
+			buf.put_32(c)
+		else:
+			var data = c.to_utf8_buffer()
+			buf.put_32(4) # STRING
+			buf.put_32(data.size())
+			buf.put_data(data)
+			for i in range((4 - data.size() % 4) % 4):
+				buf.put_u8(0)
+	for l in lines:
+		buf.put_32(l[0])
+		buf.put_32(l[1])
+	for v in token_values:
+		if v > 0x7f:
+			buf.put_32(v | 0x80)
+		else:
+			buf.put_u8(v)
+	return buf.data_array
+
+# Writes a synthetic Godot 4 project of import metadata under dir: single and multi destination texture imports
+# (the latter without a deps section), sample imports, .remap files of exported scenes, and imports and remaps that
+# share their destination file with an earlier one. Returns import metadata path -> the source md5 in its .md5 file,
+# or "" if it has none.
+static func make_import_project(dir: String, num_imports: int) -> Dictionary:
+	var source_md5s = {}
+	var last_dest = ""
+	var last_scene = ""
+	for i in range(num_imports):
+		var name_md5 = ("import_" + str(i)).md5_text()
+		var md5_file = ""
+		var import_path = ""
+		var cf = ConfigFile.new()
+		match i % 4:
+			0, 2:
+				var source = "res://textures/tex_%d.png" % i if i % 4 == 0 else "res://sounds/snd_%d.wav" % i
+				var dest = "res://.godot/imported/%s-%s.%s" % [source.get_file(), name_md5, "ctex" if i % 4 == 0 else "sample"]
+				if i % 10 == 6:
+					dest = last_dest
+				else:
+					md5_file = dest.get_basename() + ".md5"
+				last_dest = dest
+				cf.set_value("remap", "importer", "texture" if i % 4 == 0 else "wav")
+				cf.set_value("remap", "type", "CompressedTexture2D" if i % 4 == 0 else "AudioStreamWAV")
+				cf.set_value("remap", "path", dest)
+				cf.set_value("deps", "source_file", source)
+				cf.set_value("deps", "dest_files", PackedStringArray([dest]))
+				cf.set_value("params", "compress/mode", i % 3)
+				cf.set_value("params", "flags/filter", i % 2 == 0)
+				import_path = source + ".import"
+			1:
+				# a multi-destination import, Godot 4 strips the deps section
+				var source = "res://textures/multi_%d.png" % i
+				cf.set_value("remap", "importer", "texture")
+				cf.set_value("remap", "type", "CompressedTexture2D")
+				cf.set_value("remap", "path.s3tc", "res://.godot/imported/multi_%d.png-%s.s3tc.ctex" % [i, name_md5])
+				cf.set_value("remap", "path.etc2", "res://.godot/imported/multi_%d.png-%s.etc2.ctex" % [i, name_md5])
+				cf.set_value("params", "compress/mode", 2)
+				import_path = source + ".import"
+			3:
+				# an exported scene, the remap target has to be a real resource
+				var dest = "res://.godot/exported/133200997/export-%s-level_%d.scn" % [name_md5, i]
+				if i % 8 == 7 and not last_scene.is_empty():
+					dest = last_scene
+				else:
+					var abs_dest = dir.path_join(dest.replace("res://", ""))
+					DirAccess.make_dir_recursive_absolute(abs_dest.get_base_dir())
+					var node = Node.new()
+					var scene = PackedScene.new()
+					scene.pack(node)
+					node.free()
+					ResourceSaver.save(scene, abs_dest)
+				last_scene = dest
+				cf.set_value("remap", "path", dest)
+				import_path = "res://scenes/level_%d.tscn.remap" % i
+		var abs_path = dir.path_join(import_path.replace("res://", ""))
+		DirAccess.make_dir_recursive_absolute(abs_path.get_base_dir())
+		cf.save(abs_path)
+		source_md5s[import_path] = ""
+		if not md5_file.is_empty():
+			source_md5s[import_path] = name_md5
+			var md5_text = "source_md5=\"%s\"\ndest_md5=\"%s\"\n" % [name_md5, name_md5.md5_text()]
+			write_file(dir.path_join(md5_file.replace("res://", "")), md5_text.to_utf8_buffer())
+	return source_md5s
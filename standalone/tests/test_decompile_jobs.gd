@@ -0,0 +1,81 @@
+extends SceneTree
+
+# Decompiles a synthetic 3.5 pack of compiled scripts with ImportExporter.decompile_scripts(), once with 1 job and
+# once with the default job count, and checks that both produce the same files, that every script decompiles to
+# its source, and that the corrupt scripts fail in both runs.
+# Run with: godot --headless --path standalone --script res://tests/test_decompile_jobs.gd
+
+const Common = preload("res://tests/test_common.gd")
+const Tables = preload("res://tests/bytecode_revision_tables.gd")
+
+const NUM_SCRIPTS = 64
+const CORRUPT_SCRIPTS = [7, 40]
+
+func make_script(i: int) -> Array:
+	var func_name = "func_" + str(i)
+	var identifiers = ["Node", func_name, "value"]
+	var tokens = [
+		"TK_PR_EXTENDS", ["TK_IDENTIFIER", "Node"], ["TK_NEWLINE", 0],
+		"TK_PR_FUNCTION", ["TK_IDENTIFIER", func_name], "TK_PARENTHESIS_OPEN", ["TK_IDENTIFIER", "value"], "TK_PARENTHESIS_CLOSE", "TK_COLON", ["TK_NEWLINE", 1],
+		"TK_CF_RETURN", ["TK_IDENTIFIER", "value"], "TK_OP_ADD", ["TK_CONSTANT", 0], ["TK_NEWLINE", 0],
+	]
+	var text = "extends Node\nfunc %s(value):\n\treturn value + %d\n" % [func_name, i]
+	return [Common.make_gdsc(Tables.REVISIONS["a7aad78"], identifiers, [i], tokens), text]
+
+func decompile(pck: String, output_dir: String, num_jobs: int) -> Array:
+	if GDRESettings.load_pack(pck) != OK:
+		print("Error: failed to open " + pck)
+		return [FAILED, ""]
+	var importer = ImportExporter.new()
+	importer.set_num_jobs(num_jobs)
+	var err = importer.decompile_scripts(output_dir)
+	var report = importer.get_report()
+	importer.reset()
+	GDRESettings.unload_pack()
+	return [err, report]
+
+func _init():
+	var out_dir = OS.get_user_data_dir().path_join("test_decompile_jobs")
+	var fixture_dir = out_dir.path_join("fixture")
+	Common.remove_dir(out_dir)
+	var expected = {}
+	for i in range(NUM_SCRIPTS):
+		var script = make_script(i)
+		var path = "scripts_" + str(i % 5) + "/script_" + str(i) + ".gdc"
+		if CORRUPT_SCRIPTS.has(i):
+			# cut off in the middle of the token stream
+			script[0] = script[0].slice(0, script[0].size() - 6)
+		else:
+			expected[path.replace(".gdc", ".gd")] = script[1]
+		Common.write_file(fixture_dir.path_join(path), script[0])
+	var pck = out_dir.path_join("scripts.pck")
+	if Common.create_pck(fixture_dir, pck, 1, "3.5.1") != OK:
+		print("Error: failed to create the fixture pack")
+		quit(1)
+		return
+
+	var failed = 0
+	var serial_dir = out_dir.path_join("serial")
+	var parallel_dir = out_dir.path_join("parallel")
+	var serial = decompile(pck, serial_dir, 1)
+	var parallel = decompile(pck, parallel_dir, -1)
+	for result in [serial, parallel]:
+		if result[0] == OK:
+			print("FAIL: the corrupt scripts were not reported")
+			failed += 1
+	failed += Common.compare_trees(serial_dir, parallel_dir)
+	if serial[1] != parallel[1]:
+		print("DIFFERS: report")
+		failed += 1
+	var files = Common.list_files(serial_dir)
+	if files.size() != expected.size():
+		print("FAIL: " + str(files.size()) + " scripts were decompiled, expected " + str(expected.size()))
+		failed += 1
+	for f in expected:
+		if not files.has(f):
+			continue
+		if FileAccess.get_file_as_string(serial_dir.path_join(f)) != expected[f]:
+			print("FAIL: " + f + " does not match its source")
+			failed += 1
+	print("Decompile jobs: " + str(failed) + " failures")
+	quit(1 if failed > 0 else 0)
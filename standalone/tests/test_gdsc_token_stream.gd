@@ -0,0 +1,57 @@
+extends SceneTree
+
+# Checks the shared GDSC header parser through every registered decompiler: identifiers of every padding length,
+# non-ASCII identifiers, more than 128 identifiers (4-byte tokens) and truncated buffers.
+# Run with: godot --headless --path standalone --script res://tests/test_gdsc_token_stream.gd
+
+const Common = preload("res://tests/test_common.gd")
+const Tables = preload("res://tests/bytecode_revision_tables.gd")
+
+const NUM_IDENTIFIERS = 300
+
+func make_identifiers() -> Array:
+	var identifiers = ["a", "ab", "abc", "abcd", "abcde", "größe", "名前", "emoji_🙂"]
+	while identifiers.size() < NUM_IDENTIFIERS:
+		identifiers.append("var_" + str(identifiers.size()))
+	return identifiers
+
+# one "var <identifier>" line per identifier
+func make_script(rev: Dictionary, identifiers: Array) -> Array:
+	var tokens = []
+	var text = ""
+	for ident in identifiers:
+		tokens.append_array(["TK_PR_VAR", ["TK_IDENTIFIER", ident], ["TK_NEWLINE", 0]])
+		text += "var " + ident + "\n"
+	return [Common.make_gdsc(rev, identifiers, [], tokens), text]
+
+func decompile(rev: String, path: String) -> Array:
+	var decomp = ClassDB.instantiate("GDScriptDecomp_" + rev)
+	var err = decomp.decompile_byte_code(path)
+	var text = decomp.get_script_text()
+	decomp.free()
+	return [err, text]
+
+func _init():
+	var out_dir = OS.get_user_data_dir().path_join("test_gdsc_token_stream")
+	Common.remove_dir(out_dir)
+	DirAccess.make_dir_recursive_absolute(out_dir)
+	var identifiers = make_identifiers()
+	var failed = 0
+	for rev in Tables.REVISIONS:
+		var script = make_script(Tables.REVISIONS[rev], identifiers)
+		var path = out_dir.path_join(rev + ".gdc")
+		Common.write_file(path, script[0])
+		var result = decompile(rev, path)
+		if result[0] != OK or result[1] != script[1]:
+			print("FAIL: " + rev + ": script was not decompiled to its source")
+			failed += 1
+
+		# cut inside the header, the identifiers and the tokens
+		for size in [8, 30, script[0].size() / 2, script[0].size() - 1]:
+			var truncated = out_dir.path_join(rev + "_" + str(size) + ".gdc")
+			Common.write_file(truncated, script[0].slice(0, size))
+			if decompile(rev, truncated)[0] == OK:
+				print("FAIL: " + rev + ": script truncated to " + str(size) + " bytes was decompiled")
+				failed += 1
+	print("GDSC token stream: " + str(failed) + " failures")
+	quit(1 if failed > 0 else 0)
@@ -0,0 +1,74 @@
+extends SceneTree
+
+# Loads a pack of files with awkward names and checks that filtering the file list through GDRESettings, which
+# compiles the filters to a GlobPatternSet without character classes, selects the same files as String.match() on
+# their file names: '*' and '**' runs, '?' (which never matches '.'), '[' and ']' as literals, patterns without any
+# wildcards, and sets of several patterns at once.
+# Run with: godot --headless --path standalone --script res://tests/test_glob_filters.gd
+
+const Common = preload("res://tests/test_common.gd")
+
+const FILE_NAMES = [
+	"a", "ab", "abc", "abc.gd", "a.b", "a.b.c", "ab.c.d", "a..b", "x.png", "xy.png", "[x].png", "[!x].png", "[a-z].png",
+	"a[b]c", "a]b", "a[b", "q!.txt", "star.txt", "x.png.import", "icon.svg.import", "scene.tscn", "scene.tscn.remap",
+	"script.gdc", "script.gd.remap", "tex.ctex", "ünïcödé.txt", "日本語.res", "aXb", "a.c", "README", "Readme.md",
+	"s", "abcabcabc", "abcabd",
+]
+
+const PATTERNS = [
+	"*", "**", "***", "", "abc", "?", "??", "???", "?*", "*?", "?.png", "??.png", "*.png", "*.png*", "a?b", "a?c",
+	"*.*", "*.*.*", "?*.?*", ".*", "*.", "a*", "*c", "a*c", "a**c", "a*b*c", "*abc*", "abc*abd", "abc*abc",
+	"[x].png", "[!x].png", "[a-z].png", "[x]*", "*[*", "*]*", "a[b]c", "a[?]c", "[", "]", "*.import", "*.*.import",
+	"*.remap", "q?.txt", "q??txt", "a??b", "a?.b", "star*.txt", "*ü*", "*.res", "README", "read*", "*E", "s*", "*s",
+]
+
+# sets of filters that are matched together
+const PATTERN_SETS = [
+	["*.png", "*.import"],
+	["abc", "a", "README"],
+	["?", "??", "[x].png"],
+	["*.gdc", "*.gd.remap", "*.gd"],
+	["[a-z].png", "a?b", "*.c.*"],
+]
+
+func expected_files(files: PackedStringArray, filters: Array) -> PackedStringArray:
+	var matched = PackedStringArray()
+	for f in files:
+		for filter in filters:
+			if f.get_file().match(filter):
+				matched.append("res://" + f)
+				break
+	matched.sort()
+	return matched
+
+func check(name: String, files: PackedStringArray, filters: Array) -> int:
+	var expected = expected_files(files, filters)
+	var actual = PackedStringArray(GDRESettings.get_file_list(PackedStringArray(filters)))
+	actual.sort()
+	if actual != expected:
+		print("FAIL: " + name + " " + str(filters) + " matched\n\t" + str(actual) + "\nexpected\n\t" + str(expected))
+		return 1
+	return 0
+
+func _init():
+	var out_dir = OS.get_user_data_dir().path_join("test_glob_filters")
+	var fixture_dir = out_dir.path_join("fixture")
+	var pck = out_dir.path_join("filters.pck")
+	Common.remove_dir(out_dir)
+	for i in range(FILE_NAMES.size()):
+		# the same names in the root and in a sub directory, filters only see the file name
+		Common.write_file(fixture_dir.path_join(FILE_NAMES[i]), str(i).to_utf8_buffer())
+		Common.write_file(fixture_dir.path_join("dir.d/sub/" + FILE_NAMES[i]), str(i).to_utf8_buffer())
+	if Common.create_pck(fixture_dir, pck, 2, "4.0.0") != OK or GDRESettings.load_pack(pck) != OK:
+		print("FAIL: could not create and load the pack")
+		quit(1)
+		return
+	var files = Common.list_files(fixture_dir)
+	var failed = 0
+	for pattern in PATTERNS:
+		failed += check("pattern", files, [pattern])
+	for filters in PATTERN_SETS:
+		failed += check("pattern set", files, filters)
+	GDRESettings.unload_pack()
+	print("Glob filters: " + str(PATTERNS.size() + PATTERN_SETS.size()) + " filters, " + str(failed) + " failures")
+	quit(1 if failed > 0 else 0)
@@ -0,0 +1,44 @@
+extends SceneTree
+
+# Loads a synthetic Godot 4 project with many import files, which GDRESettings loads on the worker thread pool, and
+# checks that the result matches loading every import serially with ImportInfo.load_from_file(): the same imports
+# in pack order with the same metadata, and the source md5s from the .md5 files.
+# Run with: godot --headless --path standalone --script res://tests/test_import_load_jobs.gd
+
+const Common = preload("res://tests/test_common.gd")
+
+const NUM_IMPORTS = 1000
+
+func _init():
+	var out_dir = OS.get_user_data_dir().path_join("test_import_load_jobs")
+	var fixture_dir = out_dir.path_join("fixture")
+	Common.remove_dir(out_dir)
+	var source_md5s = Common.make_import_project(fixture_dir, NUM_IMPORTS)
+	var pck = out_dir.path_join("imports.pck")
+	if Common.create_pck(fixture_dir, pck, 2, "4.0.0") != OK or GDRESettings.load_pack(pck) != OK:
+		print("Error: failed to create or load the fixture pack")
+		quit(1)
+		return
+
+	var failed = 0
+	var infos = GDRESettings.get_import_files()
+	var import_paths = GDRESettings.get_file_list(["*.import", "*.remap"])
+	if infos.size() != import_paths.size() or infos.size() != source_md5s.size():
+		print("FAIL: " + str(infos.size()) + " imports were loaded, expected " + str(source_md5s.size()))
+		failed += 1
+	for i in range(min(infos.size(), import_paths.size())):
+		var path = import_paths[i]
+		var serial = ImportInfo.load_from_file(path, GDRESettings.get_ver_major(), GDRESettings.get_ver_minor())
+		var iinfo = infos[i]
+		if serial == null:
+			print("FAIL: " + path + " could not be loaded serially")
+			failed += 1
+		elif iinfo.as_text() != serial.as_text() or iinfo.get_ver_major() != serial.get_ver_major() or iinfo.get_ver_minor() != serial.get_ver_minor():
+			print("FAIL: " + path + " differs from the serially loaded import:\n" + iinfo.as_text() + "\n" + serial.as_text())
+			failed += 1
+		if iinfo.get_source_md5() != source_md5s.get(path, ""):
+			print("FAIL: " + path + " has source md5 '" + iinfo.get_source_md5() + "', expected '" + source_md5s.get(path, "") + "'")
+			failed += 1
+	GDRESettings.unload_pack()
+	print("Import load jobs: " + str(infos.size()) + " imports, " + str(failed) + " failures")
+	quit(1 if failed > 0 else 0)
@@ -0,0 +1,88 @@
+extends SceneTree
+
+# Loads a synthetic Godot 4 project of import metadata and checks the indexed GDRESettings lookups
+# (get_import_info(), get_import_info_by_file(), get_import_infos() and has_remap()) against a linear scan of
+# get_import_files(), including remaps and destination files shared by several imports.
+# Run with: godot --headless --path standalone --script res://tests/test_import_lookup.gd
+
+const Common = preload("res://tests/test_common.gd")
+
+const NUM_IMPORTS = 200
+
+func scan_by_path(infos: Array, path: String):
+	for iinfo in infos:
+		if iinfo.get_path() == path:
+			return iinfo
+	return null
+
+# the first import that has path as its source or one of its destinations, then the import path
+func scan_by_file(infos: Array, path: String):
+	for iinfo in infos:
+		if iinfo.get_source_file() == path or iinfo.get_dest_files().has(path):
+			return iinfo
+	return scan_by_path(infos, path)
+
+func describe(iinfo) -> String:
+	return "null" if iinfo == null else iinfo.get_import_md_path()
+
+func _init():
+	var out_dir = OS.get_user_data_dir().path_join("test_import_lookup")
+	var fixture_dir = out_dir.path_join("fixture")
+	Common.remove_dir(out_dir)
+	var source_md5s = Common.make_import_project(fixture_dir, NUM_IMPORTS)
+	var pck = out_dir.path_join("imports.pck")
+	if Common.create_pck(fixture_dir, pck, 2, "4.0.0") != OK or GDRESettings.load_pack(pck) != OK:
+		print("Error: failed to create or load the fixture pack")
+		quit(1)
+		return
+
+	var failed = 0
+	var infos = GDRESettings.get_import_files()
+	if infos.size() != source_md5s.size():
+		print("FAIL: " + str(infos.size()) + " imports were loaded, expected " + str(source_md5s.size()))
+		failed += 1
+
+	var queries = PackedStringArray(["res://missing.png", "res://.godot/imported/missing.ctex"])
+	for iinfo in infos:
+		queries.append(iinfo.get_path())
+		if not iinfo.get_source_file().is_empty():
+			queries.append(iinfo.get_source_file())
+		queries.append_array(iinfo.get_dest_files())
+	var expected_infos = []
+	for q in queries:
+		var expected = scan_by_path(infos, q)
+		var actual = GDRESettings.get_import_info(q)
+		if actual != expected:
+			print("FAIL: get_import_info(" + q + ") returned " + describe(actual) + ", expected " + describe(expected))
+			failed += 1
+		expected = scan_by_file(infos, q)
+		actual = GDRESettings.get_import_info_by_file(q)
+		if actual != expected:
+			print("FAIL: get_import_info_by_file(" + q + ") returned " + describe(actual) + ", expected " + describe(expected))
+			failed += 1
+		if expected != null and not expected_infos.has(expected):
+			expected_infos.append(expected)
+	if GDRESettings.get_import_infos(queries) != expected_infos:
+		print("FAIL: get_import_infos() does not return the unique matches in query order")
+		failed += 1
+
+	# shared destinations resolve to the first import in pack order
+	for iinfo in infos:
+		var first = scan_by_path(infos, iinfo.get_path())
+		if first != iinfo and GDRESettings.get_import_info(iinfo.get_path()) != first:
+			print("FAIL: " + iinfo.get_path() + " does not resolve to the first import that has it")
+			failed += 1
+
+	for import_path in source_md5s:
+		if not import_path.ends_with(".remap"):
+			continue
+		var iinfo = scan_by_file(infos, import_path.get_basename())
+		if iinfo == null or not GDRESettings.has_remap(import_path.get_basename(), iinfo.get_path()):
+			print("FAIL: " + import_path + " is not a remap")
+			failed += 1
+		elif GDRESettings.has_remap(import_path.get_basename(), "res://missing.scn"):
+			print("FAIL: " + import_path + " remaps to a missing file")
+			failed += 1
+	GDRESettings.unload_pack()
+	print("Import lookup: " + str(queries.size()) + " queries, " + str(failed) + " failures")
+	quit(1 if failed > 0 else 0)
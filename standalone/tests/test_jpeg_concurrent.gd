@@ -0,0 +1,72 @@
+extends SceneTree
+
+# Exports the textures of a synthetic pack as JPEGs through ImportExporter, once serially and once from several
+# worker threads at the same time, and checks that every concurrently written JPEG is byte-identical to the serial
+# one and decodes to an image of the right size.
+# Run with: godot --headless --path standalone --script res://tests/test_jpeg_concurrent.gd
+
+const Common = preload("res://tests/test_common.gd")
+
+const NUM_TEXTURES = 48
+const NUM_TASKS = 8
+
+var textures = []
+var parallel_dir = ""
+
+# every task exports every texture, so several threads are always encoding at once
+func export_all(task: int):
+	var importer = ImportExporter.new()
+	for i in range(textures.size()):
+		var f = textures[(i + task * 5) % textures.size()]
+		importer.convert_tex_to_png(parallel_dir.path_join("task_" + str(task)), "res://" + f, "res://" + f.get_basename() + ".jpg")
+	importer.reset()
+
+func _init():
+	var out_dir = OS.get_user_data_dir().path_join("test_jpeg_concurrent")
+	var fixture_dir = out_dir.path_join("fixture")
+	var serial_dir = out_dir.path_join("serial")
+	parallel_dir = out_dir.path_join("parallel")
+	Common.remove_dir(out_dir)
+	var rng = RandomNumberGenerator.new()
+	rng.seed = 0x16
+	var sizes = {}
+	for i in range(NUM_TEXTURES):
+		# L8 and RGB8 are encoded from the image as is, LA8 and RGBA8 are converted first
+		var format = [Image.FORMAT_L8, Image.FORMAT_LA8, Image.FORMAT_RGB8, Image.FORMAT_RGBA8][i % 4]
+		var width = rng.randi_range(1, 300)
+		var height = rng.randi_range(1, 300)
+		var img = Image.create_from_data(width, height, false, Image.FORMAT_RGBA8, Common.random_bytes(rng, width * height * 4))
+		img.convert(format)
+		var f = "tex_" + str(i) + ".ctex"
+		Common.write_file(fixture_dir.path_join(f), Common.make_ctex(img, false))
+		textures.append(f)
+		sizes[f.get_basename() + ".jpg"] = Vector2i(width, height)
+	var pck = out_dir.path_join("textures.pck")
+	if Common.create_pck(fixture_dir, pck, 2, "4.0.0") != OK or GDRESettings.load_pack(pck) != OK:
+		print("Error: failed to create or load the fixture pack")
+		quit(1)
+		return
+
+	var failed = 0
+	var importer = ImportExporter.new()
+	for f in textures:
+		if importer.convert_tex_to_png(serial_dir, "res://" + f, "res://" + f.get_basename() + ".jpg") != OK:
+			print("FAIL: " + f + " could not be exported serially")
+			failed += 1
+	importer.reset()
+	var group = WorkerThreadPool.add_group_task(export_all, NUM_TASKS)
+	WorkerThreadPool.wait_for_group_task_completion(group)
+	GDRESettings.unload_pack()
+
+	for f in sizes:
+		var img = Image.new()
+		if img.load_jpg_from_buffer(FileAccess.get_file_as_bytes(serial_dir.path_join(f))) != OK or img.get_size() != sizes[f]:
+			print("FAIL: " + f + " is not a valid JPEG of the texture's size")
+			failed += 1
+	for task in range(NUM_TASKS):
+		var differences = Common.compare_trees(serial_dir, parallel_dir.path_join("task_" + str(task)))
+		if differences > 0:
+			print("FAIL: task " + str(task) + ": " + str(differences) + " JPEGs differ from the serial export")
+			failed += 1
+	print("JPEG concurrent: " + str(failed) + " failures")
+	quit(1 if failed > 0 else 0)
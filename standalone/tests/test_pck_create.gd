@@ -0,0 +1,112 @@
+extends SceneTree
+
+# Builds version 1 and version 2 packs of a synthetic directory with PckCreator (including empty files, files larger
+# than the copy buffer and an encrypted version 2 pack), then checks the directory it wrote against the sources: every
+# entry's offset, size and MD5, read straight from the pack. Each pack is then re-opened through GDREPackedSource,
+# its contents are compared with the sources and PckDumper.check_md5_all_files() has to pass.
+# Run with: godot --headless --path standalone --script res://tests/test_pck_create.gd
+
+const Common = preload("res://tests/test_common.gd")
+
+const KEY = "1f5c3ab0e6d24b8c97f0a1d2e3b4c5d60718293a4b5c6d7e8f90a1b2c3d4e5f6"
+
+func make_fixture(dir: String, rng: RandomNumberGenerator):
+	Common.write_file(dir.path_join("empty.txt"), PackedByteArray())
+	Common.write_file(dir.path_join("one_byte.bin"), PackedByteArray([42]))
+	Common.write_file(dir.path_join("exactly_4k.bin"), Common.random_bytes(rng, 4096))
+	Common.write_file(dir.path_join("large/big.bin"), Common.random_bytes(rng, 3 * 1024 * 1024 + 17))
+	Common.write_file(dir.path_join("ünïcödé/файл.txt"), "non-ASCII path".to_utf8_buffer())
+	for i in range(40):
+		Common.write_file(dir.path_join("nested/dir_%d/file_%d.bin" % [i % 5, i]), Common.random_bytes(rng, rng.randi_range(1, 70000)))
+
+# reads the directory of an unencrypted pack: path -> [offset from the start of the pack, size, md5]
+func read_directory(pck: String, pack_version: int) -> Dictionary:
+	var f = FileAccess.open(pck, FileAccess.READ)
+	f.seek(4 + 16)
+	var file_base = 0
+	if pack_version == 2:
+		f.get_32() # flags
+		file_base = f.get_64()
+	f.seek(f.get_position() + 16 * 4)
+	var entries = {}
+	for i in range(f.get_32()):
+		var path = f.get_buffer(f.get_32()).get_string_from_utf8()
+		var offset = f.get_64() + file_base
+		var size = f.get_64()
+		var md5 = f.get_buffer(16).hex_encode()
+		if pack_version == 2:
+			f.get_32() # file flags
+		entries[path] = [offset, size, md5]
+	return entries
+
+func run(name: String, out_dir: String, fixture_dir: String, pack_version: int, engine_version: String, buffer_size: int, encrypted: bool) -> int:
+	var failed = 0
+	var pck = out_dir.path_join(name + ".pck")
+	var ver = engine_version.split(".")
+	var creator = PckCreator.new()
+	creator.set_pack_version(pack_version)
+	creator.set_ver_major(int(ver[0]))
+	creator.set_ver_minor(int(ver[1]))
+	creator.set_ver_rev(int(ver[2]))
+	if buffer_size > 0:
+		creator.set_buffer_size(buffer_size)
+	if encrypted:
+		creator.set_encryption_key(KEY.hex_decode())
+		creator.set_encrypt_directory(true)
+		creator.set_encrypt_include_filters(PackedStringArray(["*"]))
+	if creator.pck_create(pck, fixture_dir) != OK:
+		print("FAIL: " + name + ": PckCreator failed")
+		return 1
+	var files = Common.list_files(fixture_dir)
+	if creator.get_file_count() != files.size():
+		print("FAIL: " + name + ": packed " + str(creator.get_file_count()) + " files, expected " + str(files.size()))
+		failed += 1
+
+	if not encrypted:
+		var entries = read_directory(pck, pack_version)
+		var data = FileAccess.get_file_as_bytes(pck)
+		for f in files:
+			var source = fixture_dir.path_join(f)
+			var entry = entries.get("res://" + f)
+			if entry == null:
+				print("FAIL: " + name + ": res://" + f + " is not in the directory")
+				failed += 1
+				continue
+			if entry[2] != FileAccess.get_md5(source):
+				print("FAIL: " + name + ": res://" + f + " is stored with md5 " + entry[2] + ", expected " + FileAccess.get_md5(source))
+				failed += 1
+			if entry[1] != FileAccess.get_file_as_bytes(source).size() or data.slice(entry[0], entry[0] + entry[1]) != FileAccess.get_file_as_bytes(source):
+				print("FAIL: " + name + ": res://" + f + " is not stored at its offset and size")
+				failed += 1
+
+	if encrypted and GDRESettings.set_encryption_key_string(KEY) != OK:
+		print("FAIL: " + name + ": could not set the encryption key")
+		return failed + 1
+	if GDRESettings.load_pack(pck) != OK:
+		print("FAIL: " + name + ": could not re-open the pack")
+		return failed + 1
+	failed += Common.check_pack_contents(fixture_dir)
+	var dumper = PckDumper.new()
+	if dumper.check_md5_all_files() != OK or not dumper.get_broken_files().is_empty():
+		print("FAIL: " + name + ": md5 check failed for " + str(dumper.get_broken_files()))
+		failed += 1
+	GDRESettings.unload_pack()
+	if encrypted:
+		GDRESettings.reset_encryption_key()
+	return failed
+
+func _init():
+	var out_dir = OS.get_user_data_dir().path_join("test_pck_create")
+	var fixture_dir = out_dir.path_join("fixture")
+	Common.remove_dir(out_dir)
+	var rng = RandomNumberGenerator.new()
+	rng.seed = 0x21
+	make_fixture(fixture_dir, rng)
+	var failed = 0
+	failed += run("v1", out_dir, fixture_dir, 1, "3.5.1", 0, false)
+	failed += run("v1_small_buffer", out_dir, fixture_dir, 1, "3.5.1", 4096, false)
+	failed += run("v2", out_dir, fixture_dir, 2, "4.0.0", 0, false)
+	failed += run("v2_small_buffer", out_dir, fixture_dir, 2, "4.0.0", 4096, false)
+	failed += run("v2_encrypted", out_dir, fixture_dir, 2, "4.0.0", 0, true)
+	print("PCK create: " + str(failed) + " failures")
+	quit(1 if failed > 0 else 0)
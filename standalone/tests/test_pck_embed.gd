@@ -0,0 +1,141 @@
+extends SceneTree
+
+# Embeds a pack into a synthetic 64-bit ELF executable and into a plain blob with PckCreator, then checks that
+# the ELF "pck" section was patched, that the embedded pack starts 8-byte aligned, and that
+# GDREPackedSource finds the pack again (through the section for the ELF, from the file tail for the blob).
+# Run with: godot --headless --path standalone --script res://tests/test_pck_embed.gd
+
+const Common = preload("res://tests/test_common.gd")
+
+const PCK_MAGIC = 0x43504447
+const SECTION_HEADER_SIZE = 64
+const PACK_TYPE_EXE = 4 # GDRESettings::PackInfo::EXE
+
+func make_elf(code_size: int) -> PackedByteArray:
+	var names = ".shstrtab".to_ascii_buffer()
+	var strtab = PackedByteArray([0])
+	strtab.append_array(names)
+	strtab.append(0)
+	var pck_name_ofs = strtab.size()
+	strtab.append_array("pck".to_ascii_buffer())
+	strtab.append(0)
+
+	var strtab_pos = 64
+	var section_table_pos = strtab_pos + strtab.size()
+	section_table_pos += (8 - section_table_pos % 8) % 8
+	var code_pos = section_table_pos + 3 * SECTION_HEADER_SIZE
+
+	var elf = StreamPeerBuffer.new()
+	elf.put_data(PackedByteArray([0x7f, 0x45, 0x4c, 0x46, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0]))
+	elf.put_16(2) # e_type: executable
+	elf.put_16(0x3e) # e_machine: x86-64
+	elf.put_32(1) # e_version
+	elf.put_64(0) # e_entry
+	elf.put_64(0) # e_phoff
+	elf.put_64(section_table_pos) # e_shoff
+	elf.put_32(0) # e_flags
+	elf.put_16(64) # e_ehsize
+	elf.put_16(0) # e_phentsize
+	elf.put_16(0) # e_phnum
+	elf.put_16(SECTION_HEADER_SIZE) # e_shentsize
+	elf.put_16(3) # e_shnum
+	elf.put_16(1) # e_shstrndx
+	elf.put_data(strtab)
+	while elf.get_position() < section_table_pos:
+		elf.put_u8(0)
+	# null section
+	for i in range(SECTION_HEADER_SIZE):
+		elf.put_u8(0)
+	for section in [[1, 3, strtab_pos, strtab.size()], [pck_name_ofs, 1, 0, 0]]:
+		elf.put_32(section[0]) # sh_name
+		elf.put_32(section[1]) # sh_type
+		elf.put_64(0) # sh_flags
+		elf.put_64(0) # sh_addr
+		elf.put_64(section[2]) # sh_offset
+		elf.put_64(section[3]) # sh_size
+		elf.put_32(0) # sh_link
+		elf.put_32(0) # sh_info
+		elf.put_64(1) # sh_addralign
+		elf.put_64(0) # sh_entsize
+	# some "code" with an odd size, so the pack has to be padded to stay aligned
+	for i in range(code_size):
+		elf.put_u8(i % 251)
+	assert(elf.get_position() == code_pos + code_size)
+	return elf.data_array
+
+func get_pck_section(path: String) -> Array:
+	var f = FileAccess.open(path, FileAccess.READ)
+	f.seek(0x28)
+	var section_table_pos = f.get_64()
+	f.seek(section_table_pos + 2 * SECTION_HEADER_SIZE + 0x18)
+	var offset = f.get_64()
+	var size = f.get_64()
+	return [offset, size]
+
+# Returns the position of the pack header after p_from, allowing for the alignment padding
+func find_header(path: String, from: int) -> int:
+	var f = FileAccess.open(path, FileAccess.READ)
+	for i in range(8):
+		f.seek(from + i)
+		if f.get_32() == PCK_MAGIC:
+			return from + i
+	return -1
+
+func check_pack(name: String, exe_path: String, fixture_dir: String) -> int:
+	var err = GDRESettings.load_pack(exe_path)
+	if err != OK:
+		print("FAIL: " + name + ": could not load the embedded pack (" + str(err) + ")")
+		return 1
+	var failed = 0
+	if GDRESettings.get_pack_type() != PACK_TYPE_EXE:
+		print("FAIL: " + name + ": pack was not detected as an executable")
+		failed += 1
+	failed += Common.check_pack_contents(fixture_dir)
+	GDRESettings.unload_pack()
+	return failed
+
+func _init():
+	var out_dir = OS.get_user_data_dir().path_join("test_pck_embed")
+	var fixture_dir = out_dir.path_join("fixture")
+	Common.remove_dir(out_dir)
+	var rng = RandomNumberGenerator.new()
+	rng.seed = 0x22
+	for i in range(12):
+		Common.write_file(fixture_dir.path_join("dir_" + str(i % 3)).path_join("file_" + str(i) + ".bin"), Common.random_bytes(rng, rng.randi_range(0, 5000)))
+
+	var failed = 0
+	for code_size in [1001, 4096]:
+		var name = "ELF with " + str(code_size) + " code bytes"
+		var host = out_dir.path_join("host_" + str(code_size) + ".x86_64")
+		var exe = out_dir.path_join("embedded_" + str(code_size) + ".x86_64")
+		Common.write_file(host, make_elf(code_size))
+		if Common.create_pck(fixture_dir, exe, 1, "3.5.1", host) != OK:
+			print("FAIL: " + name + ": PckCreator failed")
+			failed += 1
+			continue
+		var host_size = FileAccess.get_file_as_bytes(host).size()
+		var section = get_pck_section(exe)
+		if section[0] != host_size or section[1] == 0:
+			print("FAIL: " + name + ": pck section was not patched (offset " + str(section[0]) + ", size " + str(section[1]) + ")")
+			failed += 1
+		var header_pos = find_header(exe, host_size)
+		if header_pos < 0 or header_pos % 8 != 0:
+			print("FAIL: " + name + ": embedded pack header is not 8-byte aligned (" + str(header_pos) + ")")
+			failed += 1
+		if FileAccess.get_file_as_bytes(exe).slice(0, 64) != FileAccess.get_file_as_bytes(host).slice(0, 64):
+			print("FAIL: " + name + ": ELF header was modified")
+			failed += 1
+		failed += check_pack(name, exe, fixture_dir)
+
+	# no section to patch, the pack has to be found from the tail of the file
+	var blob = out_dir.path_join("host.bin")
+	var blob_exe = out_dir.path_join("embedded.bin")
+	Common.write_file(blob, Common.random_bytes(rng, 777))
+	if Common.create_pck(fixture_dir, blob_exe, 2, "4.0.0", blob) != OK:
+		print("FAIL: blob: PckCreator failed")
+		failed += 1
+	else:
+		failed += check_pack("blob", blob_exe, fixture_dir)
+
+	print("PCK embedding: " + str(failed) + " failures")
+	quit(1 if failed > 0 else 0)
@@ -0,0 +1,60 @@
+extends SceneTree
+
+# Extracts a synthetic pack with PckDumper.pck_dump_to_dir() with 1 job and with the default job count, with and
+# without MD5 checks and with a small and the default copy buffer, and checks that every run writes the same tree
+# as the files that were packed, including empty files and files larger than the buffer.
+# Run with: godot --headless --path standalone --script res://tests/test_pck_extract_jobs.gd
+
+const Common = preload("res://tests/test_common.gd")
+
+const NUM_FILES = 150
+
+func extract(pck: String, output_dir: String, num_jobs: int, check_md5: bool, buffer_size: int) -> int:
+	if GDRESettings.load_pack(pck) != OK:
+		print("Error: failed to open " + pck)
+		return FAILED
+	var dumper = PckDumper.new()
+	dumper.set_num_jobs(num_jobs)
+	dumper.set_check_md5_on_extract(check_md5)
+	if buffer_size > 0:
+		dumper.set_buffer_size(buffer_size)
+	var err = dumper.pck_dump_to_dir(output_dir)
+	GDRESettings.unload_pack()
+	return err
+
+func _init():
+	var out_dir = OS.get_user_data_dir().path_join("test_pck_extract_jobs")
+	var fixture_dir = out_dir.path_join("fixture")
+	Common.remove_dir(out_dir)
+	var rng = RandomNumberGenerator.new()
+	rng.seed = 0x8
+	for i in range(NUM_FILES):
+		var size = 0 if i % 25 == 0 else (rng.randi_range(1, 2000) if i % 6 else rng.randi_range(100000, 3000000))
+		# nested directories that share parents, so the same directories are needed by many files
+		var path = "a_" + str(i % 3) + "/b_" + str(i % 5) + "/file_" + str(i) + ".bin"
+		if i % 7 == 0:
+			path = "file_" + str(i) + ".bin"
+		Common.write_file(fixture_dir.path_join(path), Common.random_bytes(rng, size))
+	var pck = out_dir.path_join("files.pck")
+	if Common.create_pck(fixture_dir, pck, 2, "4.0.0") != OK:
+		print("Error: failed to create the fixture pack")
+		quit(1)
+		return
+
+	var failed = 0
+	for num_jobs in [1, -1]:
+		for check_md5 in [false, true]:
+			# 0 keeps the default buffer size, 4096 is the smallest one used
+			for buffer_size in [0, 4096]:
+				var name = "jobs_%d_md5_%s_buffer_%d" % [num_jobs, str(check_md5), buffer_size]
+				var output_dir = out_dir.path_join(name)
+				if extract(pck, output_dir, num_jobs, check_md5, buffer_size) != OK:
+					print("FAIL: " + name + ": pck_dump_to_dir() failed")
+					failed += 1
+					continue
+				var differences = Common.compare_trees(fixture_dir, output_dir)
+				if differences > 0:
+					print("FAIL: " + name + ": " + str(differences) + " files differ from the packed files")
+					failed += 1
+	print("PCK extract jobs: " + str(failed) + " failures")
+	quit(1 if failed > 0 else 0)
@@ -0,0 +1,46 @@
+extends SceneTree
+
+# Checks that a pack whose header claims more files than its directory can hold is rejected up front,
+# and that the unmodified pack still loads.
+# Run with: godot --headless --path standalone --script res://tests/test_pck_file_count.gd
+
+const Common = preload("res://tests/test_common.gd")
+
+# position of the file count in the header, after the magic, versions, flags/file base and reserved fields
+const FILE_COUNT_POS = { 1: 4 + 16 + 64, 2: 4 + 16 + 4 + 8 + 64 }
+
+func _init():
+	var out_dir = OS.get_user_data_dir().path_join("test_pck_file_count")
+	var fixture_dir = out_dir.path_join("fixture")
+	Common.remove_dir(out_dir)
+	var rng = RandomNumberGenerator.new()
+	rng.seed = 0x5
+	for i in range(4):
+		Common.write_file(fixture_dir.path_join("file_" + str(i) + ".bin"), Common.random_bytes(rng, 64))
+
+	var failed = 0
+	for version in [1, 2]:
+		var pck = out_dir.path_join("v" + str(version) + ".pck")
+		if Common.create_pck(fixture_dir, pck, version, "3.5.1" if version == 1 else "4.0.0") != OK:
+			print("FAIL: v" + str(version) + ": PckCreator failed")
+			failed += 1
+			continue
+		if GDRESettings.load_pack(pck) != OK:
+			print("FAIL: v" + str(version) + ": the unmodified pack did not load")
+			failed += 1
+		else:
+			failed += Common.check_pack_contents(fixture_dir)
+			GDRESettings.unload_pack()
+
+		for count in [0x10000, 0x7fffffff, 0xffffffff]:
+			var data = FileAccess.get_file_as_bytes(pck)
+			data.encode_u32(FILE_COUNT_POS[version], count)
+			var corrupt = out_dir.path_join("v" + str(version) + "_" + str(count) + ".pck")
+			Common.write_file(corrupt, data)
+			if GDRESettings.load_pack(corrupt) == OK:
+				print("FAIL: v" + str(version) + ": pack claiming " + str(count) + " files was loaded")
+				failed += 1
+				GDRESettings.unload_pack()
+
+	print("PCK file count: " + str(failed) + " failures")
+	quit(1 if failed > 0 else 0)
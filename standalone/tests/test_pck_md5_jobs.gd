@@ -0,0 +1,83 @@
+extends SceneTree
+
+# Corrupts some entries of a synthetic pack and runs PckDumper.check_md5_all_files() with 1 job and with the default
+# job count, checking that both runs report exactly the corrupted files, in pack order.
+# Run with: godot --headless --path standalone --script res://tests/test_pck_md5_jobs.gd
+
+const Common = preload("res://tests/test_common.gd")
+
+const NUM_FILES = 120
+const CORRUPT_EVERY = 9
+
+# every file starts with a unique marker so it can be found in the pack
+func marker(i: int) -> String:
+	return "<file %04d>" % i
+
+func check(pck: String, num_jobs: int) -> Array:
+	if GDRESettings.load_pack(pck) != OK:
+		print("Error: failed to open " + pck)
+		return [FAILED, PackedStringArray(), PackedStringArray()]
+	var dumper = PckDumper.new()
+	dumper.set_num_jobs(num_jobs)
+	var err = dumper.check_md5_all_files()
+	var broken = dumper.get_broken_files()
+	var pack_order = GDRESettings.get_file_list()
+	GDRESettings.unload_pack()
+	return [err, broken, pack_order]
+
+func _init():
+	var out_dir = OS.get_user_data_dir().path_join("test_pck_md5_jobs")
+	var fixture_dir = out_dir.path_join("fixture")
+	Common.remove_dir(out_dir)
+	var rng = RandomNumberGenerator.new()
+	rng.seed = 0x7
+	var corrupted = []
+	for i in range(NUM_FILES):
+		var data = marker(i).to_ascii_buffer()
+		data.append_array(Common.random_bytes(rng, rng.randi_range(1, 3000) if i % 10 else 300000))
+		var path = "dir_" + str(i % 4) + "/file_" + str(i) + ".bin"
+		Common.write_file(fixture_dir.path_join(path), data)
+		if i % CORRUPT_EVERY == 0:
+			corrupted.append("res://" + path)
+	var pck = out_dir.path_join("files.pck")
+	if Common.create_pck(fixture_dir, pck, 2, "4.0.0") != OK:
+		print("Error: failed to create the fixture pack")
+		quit(1)
+		return
+
+	var failed = 0
+	var clean = check(pck, -1)
+	if clean[0] != OK or not clean[1].is_empty():
+		print("FAIL: the unmodified pack did not verify: " + str(clean[1]))
+		failed += 1
+
+	# flip the byte after the marker of every corrupted file
+	var data = FileAccess.get_file_as_bytes(pck)
+	var hex = data.hex_encode()
+	for i in range(0, NUM_FILES, CORRUPT_EVERY):
+		var pos = hex.find(marker(i).to_ascii_buffer().hex_encode())
+		if pos < 0 or pos % 2:
+			print("Error: " + marker(i) + " was not found in the pack")
+			quit(1)
+			return
+		var ofs = pos / 2 + marker(i).length()
+		data[ofs] = data[ofs] ^ 0xff
+	Common.write_file(pck, data)
+
+	var expected = PackedStringArray()
+	for f in clean[2]:
+		if corrupted.has(f):
+			expected.append(f)
+	if expected.size() != corrupted.size():
+		print("FAIL: the pack lists " + str(expected.size()) + " of the " + str(corrupted.size()) + " corrupted files")
+		failed += 1
+	for num_jobs in [1, -1]:
+		var result = check(pck, num_jobs)
+		if result[0] != ERR_BUG:
+			print("FAIL: " + str(num_jobs) + " jobs: check_md5_all_files() returned " + str(result[0]) + ", expected ERR_BUG")
+			failed += 1
+		if result[1] != expected:
+			print("FAIL: " + str(num_jobs) + " jobs: reported " + str(result[1]) + ", expected " + str(expected))
+			failed += 1
+	print("PCK MD5 jobs: " + str(failed) + " failures")
+	quit(1 if failed > 0 else 0)
@@ -0,0 +1,81 @@
+extends SceneTree
+
+# Exports synthetic Godot 3 (.stex) and Godot 4 (.ctex) textures from a pack through ImportExporter and checks that
+# every exported PNG is byte-identical to the source image saved with Image.save_png_to_buffer().
+# Run with: godot --headless --path standalone --script res://tests/test_texture_export.gd
+
+const Common = preload("res://tests/test_common.gd")
+
+const V3_FORMAT_BIT_HAS_MIPMAPS = 1 << 23
+
+# StreamTexture (.stex) holding raw image data, v3 image formats up to RGBA8 have the same values as in v4
+func make_stex(img: Image) -> PackedByteArray:
+	var buf = StreamPeerBuffer.new()
+	buf.put_data("GDST".to_ascii_buffer())
+	buf.put_16(img.get_width())
+	buf.put_16(0) # custom width
+	buf.put_16(img.get_height())
+	buf.put_16(0) # custom height
+	buf.put_32(0) # flags
+	buf.put_32(img.get_format() | (V3_FORMAT_BIT_HAS_MIPMAPS if img.has_mipmaps() else 0))
+	buf.put_data(img.get_data())
+	return buf.data_array
+
+func make_image(rng: RandomNumberGenerator, width: int, height: int, format: int, mipmaps: bool) -> Image:
+	var img = Image.create_from_data(width, height, false, Image.FORMAT_RGBA8, Common.random_bytes(rng, width * height * 4))
+	img.convert(format)
+	if mipmaps:
+		img.generate_mipmaps()
+	return img
+
+func run(name: String, out_dir: String, pack_version: int, engine_version: String, textures: Dictionary) -> int:
+	var fixture_dir = out_dir.path_join(name)
+	var pck = out_dir.path_join(name + ".pck")
+	for f in textures:
+		Common.write_file(fixture_dir.path_join(f), textures[f][0])
+	if Common.create_pck(fixture_dir, pck, pack_version, engine_version) != OK:
+		print("FAIL: " + name + ": PckCreator failed")
+		return 1
+	if GDRESettings.load_pack(pck) != OK:
+		print("FAIL: " + name + ": could not load the pack")
+		return 1
+	var failed = 0
+	var output_dir = out_dir.path_join(name + "_export")
+	var importer = ImportExporter.new()
+	for f in textures:
+		var dest = f.get_basename() + ".png"
+		if importer.convert_tex_to_png(output_dir, "res://" + f, "res://" + dest) != OK:
+			print("FAIL: " + name + ": could not export " + f)
+			failed += 1
+		elif FileAccess.get_file_as_bytes(output_dir.path_join(dest)) != textures[f][1]:
+			print("FAIL: " + name + ": " + dest + " is not byte-identical to the source image")
+			failed += 1
+	importer.reset()
+	GDRESettings.unload_pack()
+	return failed
+
+func _init():
+	var out_dir = OS.get_user_data_dir().path_join("test_texture_export")
+	Common.remove_dir(out_dir)
+	var rng = RandomNumberGenerator.new()
+	rng.seed = 0x12
+
+	# file name -> [texture data, expected png]
+	var v3 = {}
+	var v4 = {}
+	for format in [Image.FORMAT_L8, Image.FORMAT_LA8, Image.FORMAT_RGB8, Image.FORMAT_RGBA8]:
+		for mipmaps in [false, true]:
+			var img = make_image(rng, 33, 17, format, mipmaps)
+			var src = img.duplicate()
+			src.clear_mipmaps()
+			var png = src.save_png_to_buffer()
+			var name = str(format) + ("_mipmaps" if mipmaps else "")
+			v3["tex_" + name + ".stex"] = [make_stex(img), png]
+			v4["tex_" + name + ".ctex"] = [Common.make_ctex(img, false), png]
+			if not mipmaps:
+				v4["tex_" + name + "_png.ctex"] = [Common.make_ctex(img, true), png]
+
+	var failed = run("v3", out_dir, 1, "3.5.1", v3)
+	failed += run("v4", out_dir, 2, "4.0.0", v4)
+	print("Texture export: " + str(failed) + " failures")
+	quit(1 if failed > 0 else 0)
@@ -0,0 +1,103 @@
+extends SceneTree
+
+# Exports a synthetic Godot 4 project whose textures were imported from JPEG and WebP sources through ImportExporter
+# and checks the outputs of the single decode shared between encoders: the JPEGs are byte-identical to converting
+# each texture on its own, the lossless PNG copies under .assets are byte-identical to the source image saved with
+# Image.save_png_to_buffer(), the WebPs decode to the source image, and no copies are written when
+# set_export_lossless_copies(false) is used. Also prints how long the export takes with and without the copies.
+# Run with: godot --headless --path standalone --script res://tests/test_texture_lossless_copy.gd
+
+const Common = preload("res://tests/test_common.gd")
+
+const NUM_TEXTURES = 64
+
+func import_file(source: String, dest: String) -> PackedByteArray:
+	var text = "[remap]\n\nimporter=\"texture\"\ntype=\"CompressedTexture2D\"\npath=\"%s\"\n\n" % dest
+	text += "[deps]\n\nsource_file=\"%s\"\ndest_files=[\"%s\"]\n\n[params]\n\ncompress/mode=0\n" % [source, dest]
+	return text.to_utf8_buffer()
+
+func export_pack(importer: ImportExporter, dir: String, copies: bool) -> int:
+	importer.reset()
+	importer.set_export_lossless_copies(copies)
+	var start = Time.get_ticks_msec()
+	var err = importer.export_imports(dir)
+	print("Exported " + str(NUM_TEXTURES) + " textures " + ("with" if copies else "without") + " lossless copies in " + str(Time.get_ticks_msec() - start) + " ms")
+	return err
+
+func _init():
+	var out_dir = OS.get_user_data_dir().path_join("test_texture_lossless_copy")
+	var fixture_dir = out_dir.path_join("fixture")
+	Common.remove_dir(out_dir)
+	var rng = RandomNumberGenerator.new()
+	rng.seed = 0x17
+	var sources = {}
+	for i in range(NUM_TEXTURES):
+		# mostly lossy JPEG sources, which are exported as JPEGs plus a PNG copy
+		var source = "res://textures/tex_%d.%s" % [i, "webp" if i % 4 == 3 else "jpg"]
+		var ctex = "res://.godot/imported/" + source.get_file() + "-" + source.md5_text() + ".ctex"
+		var width = rng.randi_range(1, 200)
+		var height = rng.randi_range(1, 200)
+		var img = Image.create_from_data(width, height, false, Image.FORMAT_RGBA8, Common.random_bytes(rng, width * height * 4))
+		# WebPs are opaque, lossless WebP is free to change the colour of fully transparent pixels
+		img.convert(Image.FORMAT_RGB8 if source.ends_with(".webp") else [Image.FORMAT_L8, Image.FORMAT_RGB8, Image.FORMAT_RGBA8][i % 3])
+		Common.write_file(fixture_dir.path_join(ctex.replace("res://", "")), Common.make_ctex(img, false))
+		Common.write_file(fixture_dir.path_join(source.replace("res://", "") + ".import"), import_file(source, ctex))
+		sources[source] = [ctex, img]
+	var pck = out_dir.path_join("textures.pck")
+	if Common.create_pck(fixture_dir, pck, 2, "4.0.0") != OK or GDRESettings.load_pack(pck) != OK:
+		print("Error: failed to create or load the fixture pack")
+		quit(1)
+		return
+
+	var failed = 0
+	var importer = ImportExporter.new()
+	var with_copies = out_dir.path_join("with_copies")
+	var without_copies = out_dir.path_join("without_copies")
+	var reference = out_dir.path_join("reference")
+	if export_pack(importer, with_copies, true) != OK or export_pack(importer, without_copies, false) != OK:
+		print("FAIL: export_imports() failed")
+		failed += 1
+	importer.reset()
+	for source in sources:
+		var ctex = sources[source][0]
+		var img: Image = sources[source][1]
+		var rel = source.replace("res://", "")
+		var copy = ".assets".path_join(rel.get_basename() + ".png")
+		if source.get_extension() == "webp":
+			# Godot 4 can import lossless WebPs, so these are re-encoded losslessly and never get a copy
+			for dir in [with_copies, without_copies]:
+				var webp = Image.new()
+				if webp.load_webp_from_buffer(FileAccess.get_file_as_bytes(dir.path_join(rel))) != OK:
+					print("FAIL: " + dir.path_join(rel) + " is not a valid WebP")
+					failed += 1
+					continue
+				img.convert(webp.get_format())
+				if webp.get_data() != img.get_data():
+					print("FAIL: " + dir.path_join(rel) + " differs from the source image")
+					failed += 1
+				if FileAccess.file_exists(dir.path_join(copy)):
+					print("FAIL: " + source + " got a lossless copy")
+					failed += 1
+			continue
+		if importer.convert_tex_to_png(reference, ctex, source) != OK:
+			print("FAIL: " + source + " could not be converted on its own")
+			failed += 1
+			continue
+		var expected_jpg = FileAccess.get_file_as_bytes(reference.path_join(rel))
+		for dir in [with_copies, without_copies]:
+			if FileAccess.get_file_as_bytes(dir.path_join(rel)) != expected_jpg:
+				print("FAIL: " + dir.path_join(rel) + " differs from converting the texture on its own")
+				failed += 1
+		if FileAccess.get_file_as_bytes(with_copies.path_join(copy)) != img.save_png_to_buffer():
+			print("FAIL: " + copy + " differs from the source image")
+			failed += 1
+		var iinfo = GDRESettings.get_import_info_by_file(source)
+		if iinfo == null or iinfo.get_export_lossless_copy() != "res://" + copy:
+			print("FAIL: " + source + " does not record its lossless copy")
+			failed += 1
+		if FileAccess.file_exists(without_copies.path_join(copy)):
+			print("FAIL: " + copy + " was written with lossless copies disabled")
+			failed += 1
+	GDRESettings.unload_pack()
+	print("Texture lossless copies: " + str(sources.size()) + " textures, " + str(failed) + " failures")
+	quit(1 if failed > 0 else 0)
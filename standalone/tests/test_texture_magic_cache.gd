@@ -0,0 +1,96 @@
+extends SceneTree
+
+# Counts how often textures are opened from a synthetic pack of Godot 4 .ctex textures.
+# Loading the pack reads the magic of every unencrypted texture once; exporting a texture then only opens it
+# to decode it. Encrypted textures are skipped when the pack is loaded, since opening them decrypts the whole
+# file, and are recognized when they are exported instead.
+# Run with: godot --headless --path standalone --script res://tests/test_texture_magic_cache.gd
+
+const Common = preload("res://tests/test_common.gd")
+
+const KEY = "7be3a47db81b29460f1a4fa5e3ab3d4ac5fb5fb2ce1f0eef30f9aed68e9eb29e"
+const NUM_TEXTURES = 20
+
+# CompressedTexture2D (.ctex) holding an uncompressed image
+func make_ctex(img: Image) -> PackedByteArray:
+	var buf = StreamPeerBuffer.new()
+	buf.put_data("GST2".to_ascii_buffer())
+	buf.put_32(1) # format version
+	buf.put_32(0) # custom width
+	buf.put_32(0) # custom height
+	buf.put_32(0) # flags
+	buf.put_32(0) # mipmap limit
+	for i in range(3):
+		buf.put_32(0) # reserved
+	buf.put_32(0) # DATA_FORMAT_IMAGE
+	buf.put_16(img.get_width())
+	buf.put_16(img.get_height())
+	buf.put_32(0) # mipmaps
+	buf.put_32(img.get_format())
+	buf.put_data(img.get_data())
+	return buf.data_array
+
+func run(name: String, fixture_dir: String, pck: String, images: Array, encrypted: bool) -> int:
+	var failed = 0
+	var filters = PackedStringArray(["*.ctex"]) if encrypted else PackedStringArray()
+	if Common.create_pck(fixture_dir, pck, 2, "4.0.0", "", filters) != OK:
+		print("FAIL: " + name + ": PckCreator failed")
+		return 1
+
+	var opens = GDRESettings.get_pack_file_open_count()
+	if GDRESettings.load_pack(pck) != OK:
+		print("FAIL: " + name + ": could not load the pack")
+		return 1
+	opens = GDRESettings.get_pack_file_open_count() - opens
+	var expected = 0 if encrypted else images.size()
+	print(name + ": " + str(opens) + " opens while loading the pack")
+	if opens != expected:
+		print("FAIL: " + name + ": expected " + str(expected) + " opens while loading the pack")
+		failed += 1
+
+	var output_dir = pck.get_basename()
+	var importer = ImportExporter.new()
+	opens = GDRESettings.get_pack_file_open_count()
+	for i in range(images.size()):
+		if importer.convert_tex_to_png(output_dir, "res://tex_" + str(i) + ".ctex", "res://tex_" + str(i) + ".png") != OK:
+			print("FAIL: " + name + ": could not export tex_" + str(i) + ".ctex")
+			failed += 1
+	opens = GDRESettings.get_pack_file_open_count() - opens
+	# encrypted textures have to be opened once more to read their magic
+	expected = images.size() * (2 if encrypted else 1)
+	print(name + ": " + str(opens) + " opens while exporting " + str(images.size()) + " textures")
+	if opens != expected:
+		print("FAIL: " + name + ": expected " + str(expected) + " opens while exporting")
+		failed += 1
+	importer.reset()
+	GDRESettings.unload_pack()
+
+	for i in range(images.size()):
+		var exported = Image.load_from_file(output_dir.path_join("tex_" + str(i) + ".png"))
+		if exported == null or exported.get_data() != images[i].get_data():
+			print("FAIL: " + name + ": tex_" + str(i) + ".png does not match the source image")
+			failed += 1
+	return failed
+
+func _init():
+	var out_dir = OS.get_user_data_dir().path_join("test_texture_magic_cache")
+	var fixture_dir = out_dir.path_join("fixture")
+	Common.remove_dir(out_dir)
+	var rng = RandomNumberGenerator.new()
+	rng.seed = 0x11
+	var images = []
+	for i in range(NUM_TEXTURES):
+		var img = Image.create_from_data(8, 8, false, Image.FORMAT_RGBA8, Common.random_bytes(rng, 8 * 8 * 4))
+		images.append(img)
+		Common.write_file(fixture_dir.path_join("tex_" + str(i) + ".ctex"), make_ctex(img))
+	Common.write_file(fixture_dir.path_join("data.bin"), Common.random_bytes(rng, 100))
+
+	if GDRESettings.set_encryption_key_string(KEY) != OK:
+		print("Error: failed to set key!")
+		quit(1)
+		return
+	var failed = run("unencrypted", fixture_dir, out_dir.path_join("plain.pck"), images, false)
+	failed += run("encrypted", fixture_dir, out_dir.path_join("encrypted.pck"), images, true)
+	GDRESettings.reset_encryption_key()
+	print("Texture magic cache: " + str(failed) + " failures")
+	quit(1 if failed > 0 else 0)
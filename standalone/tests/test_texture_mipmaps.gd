@@ -0,0 +1,111 @@
+extends SceneTree
+
+# Loads Godot 3 StreamTextures (.stex) holding mipmap chains of embedded PNG (lossless) and WebP (lossy) levels in
+# L8, LA8, RGB8 and RGBA8 through TextureLoaderCompat, and checks the loaded chain against decoding every level with
+# the engine's own loaders and converting it to the format of the first level, as the loader used to do.
+# Run with: godot --headless --path standalone --script res://tests/test_texture_mipmaps.gd
+
+const Common = preload("res://tests/test_common.gd")
+
+const V3_FORMAT_BIT_PNG = 1 << 20
+const V3_FORMAT_BIT_WEBP = 1 << 21
+const V3_FORMAT_BIT_HAS_MIPMAPS = 1 << 23
+
+func get_levels(img: Image) -> Array:
+	var levels = []
+	var data = img.get_data()
+	for i in range(img.get_mipmap_count() + 1):
+		var ofs = img.get_mipmap_offset(i)
+		var end = img.get_mipmap_offset(i + 1) if i < img.get_mipmap_count() else data.size()
+		var w = max(img.get_width() >> i, 1)
+		var h = max(img.get_height() >> i, 1)
+		levels.append(Image.create_from_data(w, h, false, img.get_format(), data.slice(ofs, end)))
+	return levels
+
+# every level is stored as "PNG " or "WEBP" followed by the file, level_formats optionally overrides the format
+# each level is stored in
+func make_stex(img: Image, webp: bool, level_formats: Array = []) -> PackedByteArray:
+	var buf = StreamPeerBuffer.new()
+	buf.put_data("GDST".to_ascii_buffer())
+	buf.put_16(img.get_width())
+	buf.put_16(0) # custom width
+	buf.put_16(img.get_height())
+	buf.put_16(0) # custom height
+	buf.put_32(0) # flags
+	buf.put_32(img.get_format() | V3_FORMAT_BIT_HAS_MIPMAPS | (V3_FORMAT_BIT_WEBP if webp else V3_FORMAT_BIT_PNG))
+	var levels = get_levels(img)
+	buf.put_32(levels.size())
+	for i in range(levels.size()):
+		var level: Image = levels[i]
+		if i < level_formats.size():
+			level.convert(level_formats[i])
+		var data = ("WEBP" if webp else "PNG ").to_ascii_buffer()
+		data.append_array(level.save_webp_to_buffer(true, 0.8) if webp else level.save_png_to_buffer())
+		buf.put_32(data.size())
+		buf.put_data(data)
+	return buf.data_array
+
+# what the loader did before decoding into a single buffer: decode each level, convert it to the format of the
+# first one and concatenate them
+func expected_chain(stex: PackedByteArray) -> Image:
+	var buf = StreamPeerBuffer.new()
+	buf.data_array = stex
+	buf.seek(20)
+	var num_levels = buf.get_32()
+	var data = PackedByteArray()
+	var first: Image = null
+	for i in range(num_levels):
+		var level_data: PackedByteArray = buf.get_data(buf.get_32())[1]
+		var level = Image.new()
+		if level_data.slice(0, 4).get_string_from_ascii() == "WEBP":
+			level.load_webp_from_buffer(level_data.slice(4))
+		else:
+			level.load_png_from_buffer(level_data.slice(4))
+		if first == null:
+			first = level
+		level.convert(first.get_format())
+		data.append_array(level.get_data())
+	return Image.create_from_data(first.get_width(), first.get_height(), true, first.get_format(), data)
+
+func _init():
+	var out_dir = OS.get_user_data_dir().path_join("test_texture_mipmaps")
+	var fixture_dir = out_dir.path_join("fixture")
+	Common.remove_dir(out_dir)
+	var rng = RandomNumberGenerator.new()
+	rng.seed = 0x13
+
+	var textures = {}
+	for format in [Image.FORMAT_L8, Image.FORMAT_LA8, Image.FORMAT_RGB8, Image.FORMAT_RGBA8]:
+		# odd sizes so the smaller levels get rounded down to 1 pixel on one side first
+		var img = Image.create_from_data(37, 20, false, Image.FORMAT_RGBA8, Common.random_bytes(rng, 37 * 20 * 4))
+		img.convert(format)
+		img.generate_mipmaps()
+		textures["png_" + str(format) + ".stex"] = make_stex(img, false)
+		textures["webp_" + str(format) + ".stex"] = make_stex(img, true)
+		# a chain whose later levels were stored in other formats than the first
+		textures["png_mixed_" + str(format) + ".stex"] = make_stex(img, false, [format, Image.FORMAT_RGB8, Image.FORMAT_L8, Image.FORMAT_RGBA8])
+	for f in textures:
+		Common.write_file(fixture_dir.path_join(f), textures[f])
+	var pck = out_dir.path_join("textures.pck")
+	if Common.create_pck(fixture_dir, pck, 1, "3.5.1") != OK or GDRESettings.load_pack(pck) != OK:
+		print("Error: failed to create or load the fixture pack")
+		quit(1)
+		return
+
+	var failed = 0
+	var loader = TextureLoaderCompat.new()
+	for f in textures:
+		var expected = expected_chain(textures[f])
+		var img = loader.load_image_from_tex("res://" + f)
+		if img == null:
+			print("FAIL: " + f + " could not be loaded")
+			failed += 1
+		elif img.get_format() != expected.get_format() or img.get_size() != expected.get_size() or not img.has_mipmaps():
+			print("FAIL: " + f + " was loaded as a %dx%d %s image, expected a mipmapped %dx%d %s image" % [img.get_width(), img.get_height(), img.get_format(), expected.get_width(), expected.get_height(), expected.get_format()])
+			failed += 1
+		elif img.get_data() != expected.get_data():
+			print("FAIL: " + f + ": the mipmap chain differs from the separately decoded levels")
+			failed += 1
+	GDRESettings.unload_pack()
+	print("Texture mipmaps: " + str(textures.size()) + " textures, " + str(failed) + " failures")
+	quit(1 if failed > 0 else 0)
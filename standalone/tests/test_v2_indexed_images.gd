@@ -0,0 +1,152 @@
+extends SceneTree
+
+# Loads Godot 2 ImageTextures (.tex) whose images are stored in the indexed, indexed alpha and intensity formats
+# through TextureLoaderCompat, and checks the expanded images against a GDScript port of the old per-pixel palette
+# expansion. Covers 256 and 16 colour images (v2 has no packed 4-bit format; 16 colour sources were stored as 8-bit
+# indices), full and short palettes, and indices past the end of a short palette, which now expand to black.
+# Run with: godot --headless --path standalone --script res://tests/test_v2_indexed_images.gd
+
+const Common = preload("res://tests/test_common.gd")
+
+const V2_IMAGE_FORMAT_INTENSITY = 1
+const V2_IMAGE_FORMAT_INDEXED = 5
+const V2_IMAGE_FORMAT_INDEXED_ALPHA = 6
+const V2_IMAGE_ENCODING_RAW = 1
+const VARIANT_INT = 3
+const VARIANT_VECTOR2 = 10
+const VARIANT_IMAGE = 21
+
+func put_ustring(buf: StreamPeerBuffer, s: String):
+	var data = s.to_utf8_buffer()
+	buf.put_32(data.size() + 1)
+	buf.put_data(data)
+	buf.put_u8(0)
+
+# a version 2 binary ImageTexture resource holding a raw image
+func make_tex(width: int, height: int, format: int, data: PackedByteArray) -> PackedByteArray:
+	var buf = StreamPeerBuffer.new()
+	buf.put_data("RSRC".to_ascii_buffer())
+	buf.put_32(0) # big endian
+	buf.put_32(0) # real64
+	buf.put_32(2) # engine major
+	buf.put_32(1) # engine minor
+	buf.put_32(1) # format version
+	put_ustring(buf, "ImageTexture")
+	buf.put_64(0) # import metadata offset
+	for i in range(14):
+		buf.put_32(0) # reserved
+	var names = ["image", "size", "flags"]
+	buf.put_32(names.size())
+	for n in names:
+		put_ustring(buf, n)
+	buf.put_32(0) # external resources
+	buf.put_32(1) # internal resources
+	put_ustring(buf, "local://1")
+	var offset_pos = buf.get_position()
+	buf.put_64(0)
+
+	var res_ofs = buf.get_position()
+	put_ustring(buf, "ImageTexture")
+	buf.put_32(names.size())
+	buf.put_32(names.find("image"))
+	buf.put_32(VARIANT_IMAGE)
+	buf.put_32(V2_IMAGE_ENCODING_RAW)
+	buf.put_32(width)
+	buf.put_32(height)
+	buf.put_32(0) # mipmaps
+	buf.put_32(format)
+	buf.put_32(data.size())
+	buf.put_data(data)
+	for i in range((4 - data.size() % 4) % 4):
+		buf.put_u8(0)
+	buf.put_32(names.find("size"))
+	buf.put_32(VARIANT_VECTOR2)
+	buf.put_float(width)
+	buf.put_float(height)
+	buf.put_32(names.find("flags"))
+	buf.put_32(VARIANT_INT)
+	buf.put_32(0)
+	buf.put_data("RSRC".to_ascii_buffer())
+	buf.seek(offset_pos)
+	buf.put_64(res_ofs)
+	return buf.data_array
+
+# the expansion convert_indexed_image() did before it used a flat palette table: one palette slice per entry and
+# one append per pixel
+func old_convert(width: int, height: int, format: int, data: PackedByteArray) -> Image:
+	var out = PackedByteArray()
+	if format == V2_IMAGE_FORMAT_INTENSITY:
+		for v in data:
+			out.append_array([255, 255, 255, v])
+		return Image.create_from_data(width, height, false, Image.FORMAT_RGBA8, out)
+	var pal_width = 3 if format == V2_IMAGE_FORMAT_INDEXED else 4
+	var palette = []
+	for i in range(width * height, data.size(), pal_width):
+		palette.append(data.slice(i, i + pal_width))
+	for i in range(width * height):
+		out.append_array(palette[data[i]])
+	return Image.create_from_data(width, height, false, Image.FORMAT_RGB8 if pal_width == 3 else Image.FORMAT_RGBA8, out)
+
+func make_indexed(rng: RandomNumberGenerator, width: int, height: int, format: int, colors: int, palette_size: int) -> PackedByteArray:
+	var data = PackedByteArray()
+	for i in range(width * height):
+		data.append(rng.randi_range(0, colors - 1))
+	if format != V2_IMAGE_FORMAT_INTENSITY:
+		data.append_array(Common.random_bytes(rng, palette_size * (3 if format == V2_IMAGE_FORMAT_INDEXED else 4)))
+	return data
+
+func _init():
+	var out_dir = OS.get_user_data_dir().path_join("test_v2_indexed_images")
+	Common.remove_dir(out_dir)
+	var rng = RandomNumberGenerator.new()
+	rng.seed = 0x14
+	var loader = TextureLoaderCompat.new()
+	var failed = 0
+	var count = 0
+
+	# name -> [format, colors, palette entries]
+	var cases = {
+		"indexed_256": [V2_IMAGE_FORMAT_INDEXED, 256, 256],
+		"indexed_16": [V2_IMAGE_FORMAT_INDEXED, 16, 256],
+		"indexed_16_short_palette": [V2_IMAGE_FORMAT_INDEXED, 16, 16],
+		"indexed_alpha_256": [V2_IMAGE_FORMAT_INDEXED_ALPHA, 256, 256],
+		"indexed_alpha_16": [V2_IMAGE_FORMAT_INDEXED_ALPHA, 16, 256],
+		"indexed_alpha_16_short_palette": [V2_IMAGE_FORMAT_INDEXED_ALPHA, 16, 16],
+		"intensity": [V2_IMAGE_FORMAT_INTENSITY, 256, 0],
+	}
+	for name in cases:
+		for size in [Vector2i(1, 1), Vector2i(17, 9), Vector2i(64, 64)]:
+			var c = cases[name]
+			var data = make_indexed(rng, size.x, size.y, c[0], c[1], c[2])
+			var path = out_dir.path_join("%s_%dx%d.tex" % [name, size.x, size.y])
+			Common.write_file(path, make_tex(size.x, size.y, c[0], data))
+			var expected = old_convert(size.x, size.y, c[0], data)
+			var img = loader.load_image_from_tex(path)
+			count += 1
+			if img == null:
+				print("FAIL: " + path.get_file() + " could not be loaded")
+				failed += 1
+			elif img.get_format() != expected.get_format() or img.get_data() != expected.get_data():
+				print("FAIL: " + path.get_file() + " differs from the old palette expansion")
+				failed += 1
+
+	# indices past the end of a short palette expand to black
+	var short_data = PackedByteArray([0, 1, 2, 3])
+	short_data.append_array([10, 20, 30, 40, 50, 60])
+	var short_path = out_dir.path_join("indexed_past_palette.tex")
+	Common.write_file(short_path, make_tex(2, 2, V2_IMAGE_FORMAT_INDEXED, short_data))
+	var short_img = loader.load_image_from_tex(short_path)
+	count += 1
+	if short_img == null or short_img.get_data() != PackedByteArray([10, 20, 30, 40, 50, 60, 0, 0, 0, 0, 0, 0]):
+		print("FAIL: indices past the end of the palette did not expand to black")
+		failed += 1
+
+	# pixel data shorter than width * height is rejected
+	var truncated_path = out_dir.path_join("indexed_truncated.tex")
+	Common.write_file(truncated_path, make_tex(4, 4, V2_IMAGE_FORMAT_INDEXED, PackedByteArray([0, 1, 2])))
+	count += 1
+	if loader.load_image_from_tex(truncated_path) != null:
+		print("FAIL: truncated indexed data was loaded")
+		failed += 1
+	print("V2 indexed images: " + str(count) + " images, " + str(failed) + " failures")
+	quit(1 if failed > 0 else 0)
@@ -110,16 +110,7 @@ static void godot_free(voidpf opaque, voidpf address) {
 }
 } // extern "C"
 
-void APKArchive::close_handle(unzFile p_file) const {
-	ERR_FAIL_COND_MSG(!p_file, "Cannot close a file if none is open.");
-	unzCloseCurrentFile(p_file);
-	unzClose(p_file);
-}
-
-unzFile APKArchive::get_file_handle(String p_file) const {
-	ERR_FAIL_COND_V_MSG(!file_exists(p_file), nullptr, "File '" + p_file + " doesn't exist.");
-	File file = files[p_file];
-
+unzFile APKArchive::_open_package(const String &p_path) const {
 	zlib_filefunc_def io;
 	memset(&io, 0, sizeof(io));
 
@@ -136,14 +127,51 @@ unzFile APKArchive::get_file_handle(String p_file) const {
 	io.alloc_mem = godot_alloc;
 	io.free_mem = godot_free;
 
-	unzFile pkg = unzOpen2(packages[file.package].filename.utf8().get_data(), &io);
-	ERR_FAIL_COND_V_MSG(!pkg, nullptr, "Cannot open file '" + packages[file.package].filename + "'.");
-	int unz_err = unzGoToFilePos(pkg, &file.file_pos);
+	return unzOpen2(p_path.utf8().get_data(), &io);
+}
+
+void APKArchive::close_handle(unzFile p_file, int p_package) {
+	ERR_FAIL_COND_MSG(!p_file, "Cannot close a file if none is open.");
+	unzCloseCurrentFile(p_file);
+	{
+		MutexLock lock(pool_mutex);
+		if (p_package >= 0 && p_package < packages.size() && packages[p_package].free_handles.size() < MAX_POOLED_HANDLES) {
+			packages.write[p_package].free_handles.push_back(p_file);
+			return;
+		}
+	}
+	unzClose(p_file);
+}
+
+unzFile APKArchive::get_file_handle(String p_file, int &r_package) {
+	const File *file = files.getptr(p_file);
+	ERR_FAIL_COND_V_MSG(!file, nullptr, "File '" + p_file + " doesn't exist.");
+
+	unzFile pkg = nullptr;
+	String pkg_path;
+	{
+		MutexLock lock(pool_mutex);
+		Package &package = packages.write[file->package];
+		if (!package.free_handles.is_empty()) {
+			pkg = package.free_handles[package.free_handles.size() - 1];
+			package.free_handles.remove_at(package.free_handles.size() - 1);
+		}
+		pkg_path = package.filename;
+	}
+	if (!pkg) {
+		pkg = _open_package(pkg_path);
+		ERR_FAIL_COND_V_MSG(!pkg, nullptr, "Cannot open file '" + pkg_path + "'.");
+	}
+
+	// the stored position points straight at the entry, so no directory scan is needed
+	unz64_file_pos file_pos = file->file_pos;
+	int unz_err = unzGoToFilePos64(pkg, &file_pos);
 	if (unz_err != UNZ_OK || unzOpenCurrentFile(pkg) != UNZ_OK) {
 		unzClose(pkg);
 		ERR_FAIL_V(nullptr);
 	}
 
+	r_package = file->package;
 	return pkg;
 }
 
@@ -174,20 +202,7 @@ bool APKArchive::try_open_pack(const String &p_path, bool p_replace_files, uint6
 		return false;
 	}
 	bool is_apk = ext == "apk";
-	zlib_filefunc_def io;
-	memset(&io, 0, sizeof(io));
-
-	io.opaque = nullptr;
-	io.zopen_file = godot_open;
-	io.zread_file = godot_read;
-	io.zwrite_file = godot_write;
-
-	io.ztell_file = godot_tell;
-	io.zseek_file = godot_seek;
-	io.zclose_file = godot_close;
-	io.zerror_file = godot_testerror;
-
-	unzFile zfile = unzOpen2(pack_path.utf8().get_data(), &io);
+	unzFile zfile = _open_package(pack_path);
 	ERR_FAIL_COND_V(!zfile, false);
 
 	unz_global_info64 gi;
@@ -214,7 +229,7 @@ bool APKArchive::try_open_pack(const String &p_path, bool p_replace_files, uint6
 		File f;
 		f.package = pkg_num;
 
-		unzGetFilePos(zfile, &f.file_pos);
+		unzGetFilePos64(zfile, &f.file_pos);
 		String original_fname = String::utf8(filename_inzip);
 		String fname;
 		if (is_apk) {
@@ -232,7 +247,7 @@ bool APKArchive::try_open_pack(const String &p_path, bool p_replace_files, uint6
 				}
 
 				// reset the position
-				unzGoToFilePos(zfile, &f.file_pos);
+				unzGoToFilePos64(zfile, &f.file_pos);
 				if ((i + 1) < gi.number_entry) {
 					unzGoToNextFile(zfile);
 				}
@@ -302,6 +317,9 @@ APKArchive::APKArchive() {
 
 APKArchive::~APKArchive() {
 	for (int i = 0; i < packages.size(); i++) {
+		for (int j = 0; j < packages[i].free_handles.size(); j++) {
+			unzClose(packages[i].free_handles[j]);
+		}
 		unzClose(packages[i].zfile);
 	}
 
@@ -314,7 +332,7 @@ Error FileAccessAPK::open_internal(const String &p_path, int p_mode_flags) {
 	ERR_FAIL_COND_V(p_mode_flags & FileAccess::WRITE, FAILED);
 	APKArchive *arch = APKArchive::get_singleton();
 	ERR_FAIL_COND_V(!arch, FAILED);
-	zfile = arch->get_file_handle(p_path);
+	zfile = arch->get_file_handle(p_path, package);
 	ERR_FAIL_COND_V(!zfile, FAILED);
 
 	int err = unzGetCurrentFileInfo64(zfile, &file_info, nullptr, 0, nullptr, 0, nullptr, 0);
@@ -330,8 +348,9 @@ void FileAccessAPK::_close() {
 
 	APKArchive *arch = APKArchive::get_singleton();
 	ERR_FAIL_COND(!arch);
-	arch->close_handle(zfile);
+	arch->close_handle(zfile, package);
 	zfile = nullptr;
+	package = -1;
 }
 
 bool FileAccessAPK::is_open() const {
@@ -34,6 +34,7 @@
 #ifdef MINIZIP_ENABLED
 
 #include "core/io/file_access_pack.h"
+#include "core/os/mutex.h"
 #include "core/templates/rb_map.h"
 
 #include "thirdparty/minizip/unzip.h"
@@ -44,26 +45,33 @@ class APKArchive : public PackSource {
 public:
 	struct File {
 		int package = -1;
-		unz_file_pos file_pos;
+		unz64_file_pos file_pos;
 		File() {}
 	};
 
 private:
+	// Handles kept open per package so opening a file doesn't have to re-read the zip directory
+	static constexpr int MAX_POOLED_HANDLES = 16;
+
 	struct Package {
 		String filename;
 		unzFile zfile = nullptr;
+		Vector<unzFile> free_handles;
 	};
 	Vector<Package> packages;
+	Mutex pool_mutex;
 
 	HashMap<String, File> files;
 
 	static APKArchive *instance;
 
+	unzFile _open_package(const String &p_path) const;
+
 public:
 	Error get_version_string_from_manifest(String &version_string);
 
-	void close_handle(unzFile p_file) const;
-	unzFile get_file_handle(String p_file) const;
+	void close_handle(unzFile p_file, int p_package);
+	unzFile get_file_handle(String p_file, int &r_package);
 
 	Error add_package(String p_name);
 
@@ -80,6 +88,7 @@ public:
 
 class FileAccessAPK : public FileAccess {
 	unzFile zfile = nullptr;
+	int package = -1;
 	unz_file_info64 file_info;
 
 	mutable bool at_eof = false;
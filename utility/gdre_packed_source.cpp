@@ -1,8 +1,11 @@
 #include "gdre_packed_source.h"
 #include "core/io/file_access_encrypted.h"
+#include "core/io/marshalls.h"
 #include "core/object/script_language.h"
 #include "gdre_settings.h"
 
+SafeNumeric<uint64_t> GDREPackedSource::opened_files;
+
 uint64_t get_offset_unix(const String &p_path) {
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
 
@@ -189,6 +192,49 @@ bool seek_offset_from_exe(Ref<FileAccess> f, const String &p_path, uint64_t p_of
 	return false;
 }
 
+// Reads the pack directory in large blocks instead of issuing several small reads per entry
+class PackDirReader {
+	static constexpr uint64_t BLOCK_SIZE = 1024 * 1024;
+
+	Ref<FileAccess> f;
+	Vector<uint8_t> buffer;
+	uint64_t pos = 0;
+	uint64_t len = 0;
+
+	// make sure at least p_size bytes are available in the buffer
+	bool _fill(uint64_t p_size) {
+		if (len - pos >= p_size) {
+			return true;
+		}
+		uint64_t remaining = len - pos;
+		uint64_t wanted = MAX(BLOCK_SIZE, p_size);
+		if ((uint64_t)buffer.size() < wanted) {
+			buffer.resize(wanted);
+		}
+		uint8_t *w = buffer.ptrw();
+		if (remaining > 0) {
+			memmove(w, w + pos, remaining);
+		}
+		pos = 0;
+		len = remaining + f->get_buffer(w + remaining, wanted - remaining);
+		return len >= p_size;
+	}
+
+public:
+	PackDirReader(const Ref<FileAccess> &p_file) :
+			f(p_file) {}
+
+	// Returns a pointer to the next p_size bytes and advances past them, or nullptr on a short read
+	const uint8_t *read(uint64_t p_size) {
+		if (!_fill(p_size)) {
+			return nullptr;
+		}
+		const uint8_t *ptr = buffer.ptr() + pos;
+		pos += p_size;
+		return ptr;
+	}
+};
+
 bool GDREPackedSource::try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) {
 	if (p_path.get_extension().to_lower() == "apk" || p_path.get_extension().to_lower() == "zip") {
 		return false;
@@ -257,6 +303,13 @@ bool GDREPackedSource::try_open_pack(const String &p_path, bool p_replace_files,
 		}
 		f = fae;
 	}
+
+	// every entry takes at least this much space, so a corrupt file count fails here instead of when the
+	// index is reserved for it
+	const uint32_t entry_size = 8 + 8 + 16 + (version == 2 ? 4 : 0);
+	uint64_t dir_remaining = f->get_length() > f->get_position() ? f->get_length() - f->get_position() : 0;
+	ERR_FAIL_COND_V_MSG(file_count > dir_remaining / (4 + entry_size), false, "Pack directory is truncated.");
+
 	String ver_string;
 
 	Ref<GodotVer> godot_ver;
@@ -284,25 +337,31 @@ bool GDREPackedSource::try_open_pack(const String &p_path, bool p_replace_files,
 			pck_path, godot_ver, version, pack_flags, file_base, file_count, is_exe ? GDRESettings::PackInfo::EXE : GDRESettings::PackInfo::PCK);
 	GDRESettings::get_singleton()->add_pack_info(pckinfo);
 
+	// The directory isn't kept in a separate flat index: every entry has to be registered with PackedData,
+	// which serves all res:// reads (including the engine's own resource loading), and with GDRESettings,
+	// which hands out PackedFileInfo to the dumper, the exporter and scripts and tracks per-file md5 results.
+	PackDirReader reader(f);
 	for (uint32_t i = 0; i < file_count; i++) {
-		uint32_t sl = f->get_32();
-		CharString cs;
-		cs.resize(sl + 1);
-		f->get_buffer((uint8_t *)cs.ptr(), sl);
-		cs[sl] = 0;
+		const uint8_t *entry = reader.read(4);
+		ERR_FAIL_COND_V_MSG(!entry, false, "Pack directory is truncated.");
+		uint32_t sl = decode_uint32(entry);
+		entry = reader.read(sl);
+		ERR_FAIL_COND_V_MSG(!entry, false, "Pack directory is truncated.");
 
+		// parse_utf8 stops at the first null, which also drops the padding Godot 4.x adds to the path
 		String path;
-		path.parse_utf8(cs.ptr());
+		path.parse_utf8((const char *)entry, sl);
 
 		ERR_FAIL_COND_V_MSG(path.get_file().find("gdre_") != -1, false, "Don't try to extract the GDRE pack files, just download the source from github.");
 
-		uint64_t ofs = file_base + f->get_64();
-		uint64_t size = f->get_64();
-		uint8_t md5[16];
+		entry = reader.read(entry_size);
+		ERR_FAIL_COND_V_MSG(!entry, false, "Pack directory is truncated.");
+		uint64_t ofs = file_base + decode_uint64(entry);
+		uint64_t size = decode_uint64(entry + 8);
+		const uint8_t *md5 = entry + 16;
 		uint32_t flags = 0;
-		f->get_buffer(md5, 16);
 		if (version == 2) {
-			flags = f->get_32();
+			flags = decode_uint32(entry + 32);
 		}
 		// add the file info to settings
 		PackedData::PackedFile pf;
@@ -324,5 +383,6 @@ bool GDREPackedSource::try_open_pack(const String &p_path, bool p_replace_files,
 	return true;
 }
 Ref<FileAccess> GDREPackedSource::get_file(const String &p_path, PackedData::PackedFile *p_file) {
+	opened_files.increment();
 	return memnew(FileAccessPack(p_path, *p_file));
 }
\ No newline at end of file
@@ -1,9 +1,13 @@
 #pragma once
 
 #include "core/io/file_access_pack.h"
+#include "core/templates/safe_refcount.h"
 
 class GDREPackedSource : public PackSource {
+	static SafeNumeric<uint64_t> opened_files;
+
 public:
 	virtual bool try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset);
 	virtual Ref<FileAccess> get_file(const String &p_path, PackedData::PackedFile *p_file);
+	static uint64_t get_opened_file_count() { return opened_files.get(); }
 };
@@ -5,6 +5,7 @@
 #include "file_access_apk.h"
 #include "gdre_logger.h"
 #include "gdre_packed_source.h"
+#include "glob.h"
 #include "util_functions.h"
 
 #include "core/config/engine.h"
@@ -12,6 +13,8 @@
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_zip.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/hash_set.h"
 #include "core/version.h"
 #include "modules/regex/regex.h"
 #include "servers/rendering_server.h"
@@ -227,6 +230,11 @@ uint32_t GDRESettings::get_file_count() const {
 	return is_pack_loaded() ? current_pack->file_count : 0;
 }
 
+// total number of files opened from PCK/EXE packs, lets tests check how often files are re-opened
+uint64_t GDRESettings::get_pack_file_open_count() const {
+	return GDREPackedSource::get_opened_file_count();
+}
+
 void GDRESettings::set_ver_rev(uint32_t p_rev) {
 	if (is_pack_loaded()) {
 		if (!has_valid_version()) {
@@ -258,8 +266,11 @@ void GDRESettings::remove_current_pack() {
 	packs.clear();
 	file_map.clear();
 	import_files.clear();
+	import_info_map.clear();
+	import_file_map.clear();
 	code_files.clear();
 	remap_iinfo.clear();
+	texture_magic_cache.clear();
 	reset_encryption_key();
 }
 
@@ -349,6 +360,7 @@ Error GDRESettings::load_dir(const String &p_path) {
 	add_pack_info(pckinfo);
 	Error err = load_import_files();
 	ERR_FAIL_COND_V_MSG(err, err, "FATAL ERROR: Could not load imported binary files!");
+	_cache_texture_magics();
 	err = get_version_from_bin_resources();
 	// this is a catastrophic failure, unload the pack
 	if (err) {
@@ -441,6 +453,7 @@ Error GDRESettings::load_pack(const String &p_path) {
 	ERR_FAIL_COND_V_MSG(!is_pack_loaded(), ERR_FILE_CANT_READ, "FATAL ERROR: loaded project pack, but didn't load files from it!");
 	err = load_import_files();
 	ERR_FAIL_COND_V_MSG(err, ERR_FILE_CANT_READ, "FATAL ERROR: Could not load imported binary files!");
+	_cache_texture_magics();
 	if (!has_valid_version()) {
 		err = get_version_from_bin_resources();
 		// this is a catastrophic failure, unload the pack
@@ -556,6 +569,8 @@ Error GDRESettings::unload_pack() {
 
 void GDRESettings::add_pack_info(Ref<PackInfo> packinfo) {
 	packs.push_back(packinfo);
+	// the pack's files are added right after this, avoid rehashing while doing so
+	file_map.reserve(file_map.size() + packinfo->file_count);
 	current_pack = packinfo;
 }
 // PackedSource doesn't pass back useful error information when loading packs,
@@ -621,16 +636,11 @@ Vector<String> GDRESettings::get_file_list(const Vector<String> &filters) {
 Array GDRESettings::get_file_info_array(const Vector<String> &filters) {
 	Array ret;
 	bool no_filters = !filters.size();
-	for (auto E : file_map) {
-		if (no_filters) {
+	// same semantics as String::match, but each filter is only parsed once
+	const GlobPatternSet filter_set(filters, false);
+	for (const auto &E : file_map) {
+		if (no_filters || filter_set.match(E.key.get_file())) {
 			ret.push_back(E.value);
-			continue;
-		}
-		for (int j = 0; j < filters.size(); j++) {
-			if (E.key.get_file().match(filters[j])) {
-				ret.push_back(E.value);
-				break;
-			}
 		}
 	}
 	return ret;
@@ -639,16 +649,10 @@ Array GDRESettings::get_file_info_array(const Vector<String> &filters) {
 Vector<Ref<PackedFileInfo>> GDRESettings::get_file_info_list(const Vector<String> &filters) {
 	Vector<Ref<PackedFileInfo>> ret;
 	bool no_filters = !filters.size();
-	for (auto E : file_map) {
-		if (no_filters) {
+	const GlobPatternSet filter_set(filters, false);
+	for (const auto &E : file_map) {
+		if (no_filters || filter_set.match(E.key.get_file())) {
 			ret.push_back(E.value);
-			continue;
-		}
-		for (int j = 0; j < filters.size(); j++) {
-			if (E.key.get_file().match(filters[j])) {
-				ret.push_back(E.value);
-				break;
-			}
 		}
 	}
 	return ret;
@@ -975,6 +979,67 @@ bool GDRESettings::has_file(const String &p_path) {
 	return file_map.has(p_path);
 }
 
+bool GDRESettings::get_cached_texture_magic(const String &p_path, uint8_t r_magic[4]) const {
+	const uint32_t *magic = texture_magic_cache.getptr(p_path);
+	if (!magic) {
+		return false;
+	}
+	memcpy(r_magic, magic, 4);
+	return true;
+}
+
+struct PackedFileOffsetSort {
+	bool operator()(const Ref<PackedFileInfo> &a, const Ref<PackedFileInfo> &b) const {
+		if (a->get_pack() != b->get_pack()) {
+			return a->get_pack() < b->get_pack();
+		}
+		return a->get_offset() < b->get_offset();
+	}
+};
+
+// Recognizing a texture only needs its magic, so read the magics of all the textures up front in pack order
+// rather than opening each file again later. The cache is keyed by the same res:// paths that get_res_path()
+// returns for packs; directories are read directly from disk and aren't cached.
+void GDRESettings::_cache_texture_magics() {
+	static const Vector<String> texture_wildcards = {
+		"*.tex",
+		"*.stex",
+		"*.tex3d",
+		"*.texarr",
+		"*.ctex",
+		"*.ctex3d",
+		"*.ctexarray",
+		"*.ccube",
+		"*.ccubearray",
+		"*.atex",
+		"*.ltex",
+		"*.cbm"
+	};
+	texture_magic_cache.clear();
+	if (get_pack_type() == PackInfo::DIR) {
+		return;
+	}
+	Vector<Ref<PackedFileInfo>> infos = get_file_info_list(texture_wildcards);
+	infos.sort_custom<PackedFileOffsetSort>();
+	texture_magic_cache.reserve(infos.size());
+	for (int i = 0; i < infos.size(); i++) {
+		// opening an encrypted file decrypts all of it, these are recognized when they're exported instead
+		if (infos[i]->is_encrypted()) {
+			continue;
+		}
+		const String path = infos[i]->get_path();
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ);
+		if (f.is_null()) {
+			continue;
+		}
+		uint32_t magic = 0;
+		if (f->get_buffer((uint8_t *)&magic, 4) != 4) {
+			continue;
+		}
+		texture_magic_cache.insert(path, magic);
+	}
+}
+
 Error GDRESettings::load_import_files() {
 	Vector<String> file_names;
 	ERR_FAIL_COND_V_MSG(!is_pack_loaded(), ERR_DOES_NOT_EXIST, "pack/dir not loaded!");
@@ -1012,38 +1077,78 @@ Error GDRESettings::load_import_files() {
 		ERR_FAIL_V_MSG(ERR_BUG, "Can't determine major version!");
 	}
 	bool should_load_md5 = _ver_major > 2 && get_file_info_list({ "*.md5" }).size() > 0;
+	Vector<ImportLoadToken> tokens;
 	for (int i = 0; i < file_names.size(); i++) {
 		String ext = file_names[i].get_extension();
 		if (ext == "gdc" || ext == "gde") {
 			code_files.push_back(file_names[i]);
+			continue;
 		} else if (ext == "remap") {
 			String ext2 = file_names[i].get_file().get_basename().get_extension();
 			// ignore, we will be handling these when decompiling
 			if (ext2 == "gd") {
 				continue;
 			}
-			Error err = _load_import_file(file_names[i], should_load_md5);
-			if (err && err != ERR_PRINTER_ON_FIRE) {
-				WARN_PRINT("Can't load import file: " + file_names[i]);
-				continue;
-			}
-			Ref<ImportInfoRemap> r_info = (Ref<ImportInfoRemap>)import_files.back();
-			remap_iinfo.insert(file_names[i], r_info);
-		} else {
-			Error err = _load_import_file(file_names[i], should_load_md5);
-			if (err && err != ERR_PRINTER_ON_FIRE) {
-				WARN_PRINT("Can't load import file: " + file_names[i]);
-			}
+		}
+		ImportLoadToken token;
+		token.path = file_names[i];
+		token.is_remap = ext == "remap";
+		token.should_load_md5 = should_load_md5;
+		tokens.push_back(token);
+	}
+
+	// loading the metadata only reads from the pack, so it can be spread over the worker threads
+	if (tokens.size() > 1 && WorkerThreadPool::get_singleton()->get_thread_count() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(
+				this,
+				&GDRESettings::_do_import_load,
+				tokens.ptrw(),
+				tokens.size(), -1, true, SNAME("GDRESettings::load_import_files"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (int i = 0; i < tokens.size(); i++) {
+			_do_import_load(i, tokens.ptrw());
+		}
+	}
+
+	// add them in file list order so the result is the same as loading serially
+	for (int i = 0; i < tokens.size(); i++) {
+		const ImportLoadToken &token = tokens[i];
+		if (token.info.is_valid()) {
+			_add_import_info(token.info);
+		}
+		if (token.err && token.err != ERR_PRINTER_ON_FIRE) {
+			WARN_PRINT("Can't load import file: " + token.path);
+			continue;
+		}
+		if (token.is_remap) {
+			Ref<ImportInfoRemap> r_info = (Ref<ImportInfoRemap>)token.info;
+			remap_iinfo.insert(token.path, r_info);
 		}
 	}
 	return OK;
 }
 
+void GDRESettings::_do_import_load(uint32_t i, ImportLoadToken *tokens) {
+	ImportLoadToken &token = tokens[i];
+	token.err = _load_import_info(token.path, token.should_load_md5, token.info);
+}
+
 Error GDRESettings::_load_import_file(const String &p_path, bool should_load_md5) {
+	Ref<ImportInfo> i_info;
+	Error err = _load_import_info(p_path, should_load_md5, i_info);
+	if (i_info.is_valid()) {
+		_add_import_info(i_info);
+	}
+	return err;
+}
+
+// Loads the import metadata without adding it to the settings; r_iinfo is set as soon as the metadata itself was loaded
+Error GDRESettings::_load_import_info(const String &p_path, bool should_load_md5, Ref<ImportInfo> &r_iinfo) {
 	Ref<ImportInfo> i_info = ImportInfo::load_from_file(p_path, get_ver_major(), get_ver_minor());
 	ERR_FAIL_COND_V_MSG(i_info.is_null(), ERR_FILE_CANT_OPEN, "Failed to load import file " + p_path);
 
-	import_files.push_back(i_info);
+	r_iinfo = i_info;
 	// get source md5 from md5 file
 	if (should_load_md5) {
 		String src = i_info->get_dest_files()[0];
@@ -1091,18 +1196,55 @@ Error GDRESettings::load_import_file(const String &p_path) {
 	return _load_import_file(p_path, false);
 }
 
-Ref<ImportInfo> GDRESettings::get_import_info(const String &p_path) {
-	Ref<ImportInfo> iinfo;
-	for (int i = 0; i < import_files.size(); i++) {
-		iinfo = import_files[i];
-		if (iinfo->get_path() == p_path) {
-			return iinfo;
+void GDRESettings::_add_import_info(const Ref<ImportInfo> &p_iinfo) {
+	import_files.push_back(p_iinfo);
+	if (!import_info_map.has(p_iinfo->get_path())) {
+		import_info_map.insert(p_iinfo->get_path(), p_iinfo);
+	}
+	String source = p_iinfo->get_source_file();
+	if (!source.is_empty() && !import_file_map.has(source)) {
+		import_file_map.insert(source, p_iinfo);
+	}
+	Vector<String> dest_files = p_iinfo->get_dest_files();
+	for (int i = 0; i < dest_files.size(); i++) {
+		if (!import_file_map.has(dest_files[i])) {
+			import_file_map.insert(dest_files[i], p_iinfo);
 		}
 	}
+}
+
+Ref<ImportInfo> GDRESettings::get_import_info(const String &p_path) {
+	const Ref<ImportInfo> *iinfo = import_info_map.getptr(p_path);
+	if (iinfo) {
+		return *iinfo;
+	}
 	// not found
 	return Ref<ImportInfo>();
 }
 
+// Looks up an import by its source file or by any of its destination files
+Ref<ImportInfo> GDRESettings::get_import_info_by_file(const String &p_path) {
+	const Ref<ImportInfo> *iinfo = import_file_map.getptr(p_path);
+	if (iinfo) {
+		return *iinfo;
+	}
+	return get_import_info(p_path);
+}
+
+// Returns the unique imports matching any of the paths, in the order they were first matched
+Array GDRESettings::get_import_infos(const Vector<String> &p_paths) {
+	Array ret;
+	HashSet<ImportInfo *> seen;
+	for (int i = 0; i < p_paths.size(); i++) {
+		Ref<ImportInfo> iinfo = get_import_info_by_file(p_paths[i]);
+		if (iinfo.is_valid() && !seen.has(iinfo.ptr())) {
+			seen.insert(iinfo.ptr());
+			ret.push_back(iinfo);
+		}
+	}
+	return ret;
+}
+
 Vector<String> GDRESettings::get_code_files() {
 	return code_files;
 }
@@ -1149,6 +1291,7 @@ void GDRESettings::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_ver_minor"), &GDRESettings::get_ver_minor);
 	ClassDB::bind_method(D_METHOD("get_ver_rev"), &GDRESettings::get_ver_rev);
 	ClassDB::bind_method(D_METHOD("get_file_count"), &GDRESettings::get_file_count);
+	ClassDB::bind_method(D_METHOD("get_pack_file_open_count"), &GDRESettings::get_pack_file_open_count);
 	ClassDB::bind_method(D_METHOD("globalize_path", "p_path", "resource_path"), &GDRESettings::globalize_path);
 	ClassDB::bind_method(D_METHOD("localize_path", "p_path", "resource_path"), &GDRESettings::localize_path);
 	ClassDB::bind_method(D_METHOD("set_project_path", "p_path"), &GDRESettings::set_project_path);
@@ -1172,6 +1315,8 @@ void GDRESettings::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("load_import_files"), &GDRESettings::load_import_files);
 	ClassDB::bind_method(D_METHOD("load_import_file", "p_path"), &GDRESettings::load_import_file);
 	ClassDB::bind_method(D_METHOD("get_import_info", "p_path"), &GDRESettings::get_import_info);
+	ClassDB::bind_method(D_METHOD("get_import_info_by_file", "p_path"), &GDRESettings::get_import_info_by_file);
+	ClassDB::bind_method(D_METHOD("get_import_infos", "p_paths"), &GDRESettings::get_import_infos);
 	ClassDB::bind_method(D_METHOD("get_code_files"), &GDRESettings::get_code_files);
 	ClassDB::bind_method(D_METHOD("get_exec_dir"), &GDRESettings::get_exec_dir);
 	ClassDB::bind_method(D_METHOD("are_imports_loaded"), &GDRESettings::are_imports_loaded);
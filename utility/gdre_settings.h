@@ -91,8 +91,13 @@ private:
 	PackedData *new_singleton = nullptr;
 	GDRELogger *logger;
 	Array import_files;
+	// import_files indexed by import path, and by source and destination files; the first import loaded wins for shared paths
+	HashMap<String, Ref<ImportInfo>> import_info_map;
+	HashMap<String, Ref<ImportInfo>> import_file_map;
 	Vector<String> code_files;
 	HashMap<String, Ref<ImportInfoRemap>> remap_iinfo;
+	// The 4 byte magic of each texture in the pack, read in one pass when the pack is loaded
+	HashMap<String, uint32_t> texture_magic_cache;
 	String gdre_resource_path = "";
 
 	String current_project_path = "";
@@ -118,7 +123,18 @@ private:
 	bool check_if_dir_is_v3();
 	bool check_if_dir_is_v2();
 	int get_ver_major_from_dir();
+	struct ImportLoadToken {
+		String path;
+		bool is_remap = false;
+		bool should_load_md5 = false;
+		Ref<ImportInfo> info;
+		Error err = OK;
+	};
 	Error _load_import_file(const String &p_path, bool should_load_md5);
+	Error _load_import_info(const String &p_path, bool should_load_md5, Ref<ImportInfo> &r_iinfo);
+	void _do_import_load(uint32_t i, ImportLoadToken *tokens);
+	void _add_import_info(const Ref<ImportInfo> &p_iinfo);
+	void _cache_texture_magics();
 	Error load_dir(const String &p_path);
 	Error unload_dir();
 	void fix_patch_number();
@@ -154,6 +170,7 @@ public:
 	uint32_t get_ver_minor() const;
 	uint32_t get_ver_rev() const;
 	uint32_t get_file_count() const;
+	uint64_t get_pack_file_open_count() const;
 	void set_ver_rev(uint32_t p_rev);
 	String globalize_path(const String &p_path, const String &resource_path = "") const;
 	String localize_path(const String &p_path, const String &resource_path = "") const;
@@ -175,9 +192,12 @@ public:
 	String get_cwd();
 	Array get_import_files(bool copy = false);
 	bool has_file(const String &p_path);
+	bool get_cached_texture_magic(const String &p_path, uint8_t r_magic[4]) const;
 	Error load_import_files();
 	Error load_import_file(const String &p_path);
 	Ref<ImportInfo> get_import_info(const String &p_path);
+	Ref<ImportInfo> get_import_info_by_file(const String &p_path);
+	Array get_import_infos(const Vector<String> &p_paths);
 	Vector<String> get_code_files();
 	String get_exec_dir();
 	bool are_imports_loaded() const;
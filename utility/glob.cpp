@@ -27,152 +27,79 @@
 #include "core/io/dir_access.h"
 #include "core/os/os.h"
 #include "core/templates/hash_map.h"
-#include "modules/regex/regex.h"
 
 #include <functional>
 namespace {
 
-// SPECIAL_CHARS
-// closing ')', '}' and ']'
-// '-' (a range in character set)
-// '&', '~', (extended character set operations)
-// '#' (comment) and WHITESPACE (ignored) in verbose mode
-static const String special_characters = "()[]{}?*+-|^$\\.&~# \t\n\r\v\f";
-
-HashMap<char32_t, String> _init_map() {
-	HashMap<char32_t, String> map;
-	for (int i = 0; i < special_characters.length(); i++) {
-		auto sc = special_characters[i];
-		map.insert(
-				static_cast<char32_t>(sc), String{ "\\" } + sc);
-	}
-	return map;
-}
+// Caches the directory handles and listings for a single glob call, so that every directory
+// is only opened and listed once, no matter how many patterns or path components refer to it.
+class DirCache {
+	struct Listing {
+		Vector<String> dirs;
+		Vector<String> files;
+	};
+
+	bool include_hidden = false;
+	HashMap<String, Ref<DirAccess>> dir_access;
+	HashMap<String, Listing> listings;
+
+public:
+	Ref<DirAccess> open(const String &p_dir) {
+		if (Ref<DirAccess> *E = dir_access.getptr(p_dir)) {
+			return *E;
+		}
+		// failures are cached as well
+		Ref<DirAccess> da = DirAccess::open(p_dir);
+		if (da.is_valid()) {
+			da->set_include_hidden(include_hidden);
+		}
+		dir_access[p_dir] = da;
+		return da;
+	}
 
-static const HashMap<char32_t, String> special_characters_map = _init_map();
+	const Listing *list(const String &p_dir) {
+		if (const Listing *E = listings.getptr(p_dir)) {
+			return E;
+		}
+		Ref<DirAccess> da = open(p_dir);
+		if (da.is_null()) {
+			return nullptr;
+		}
+		Listing listing;
+		listing.dirs = da->get_directories();
+		listing.files = da->get_files();
+		return &listings.insert(p_dir, listing)->value;
+	}
 
-bool dir_exists(const String &path, bool include_hidden = false) {
-	String basename = path.get_file();
-	Ref<DirAccess> da = DirAccess::open(path.get_base_dir());
+	DirCache(bool p_include_hidden) :
+			include_hidden(p_include_hidden) {}
+};
+
+bool dir_exists(const String &path, DirCache &cache) {
+	Ref<DirAccess> da = cache.open(path.get_base_dir());
 	if (da.is_null()) {
 		return false;
 	}
-	da->set_include_hidden(include_hidden);
-	if ((da->dir_exists(basename))) {
-		return true;
-	}
-	return false;
+	return da->dir_exists(path.get_file());
 }
 
-bool dir_or_file_exists(const String &path, bool include_hidden = false) {
+bool dir_or_file_exists(const String &path, DirCache &cache) {
 	String basename = path.get_file();
-	Ref<DirAccess> da = DirAccess::open(path.get_base_dir());
+	Ref<DirAccess> da = cache.open(path.get_base_dir());
 	if (da.is_null()) {
 		return false;
 	}
-	da->set_include_hidden(include_hidden);
-	if ((da->file_exists(basename) || da->dir_exists(basename))) {
-		return true;
-	}
-	return false;
-}
-
-String translate(const String &pattern) {
-	std::size_t i = 0, n = pattern.length();
-	String result_string;
-
-	while (i < n) {
-		auto c = pattern[i];
-		i += 1;
-		if (c == '*') {
-			result_string += ".*";
-		} else if (c == '?') {
-			result_string += ".";
-		} else if (c == '[') {
-			auto j = i;
-			if (j < n && pattern[j] == '!') {
-				j += 1;
-			}
-			if (j < n && pattern[j] == ']') {
-				j += 1;
-			}
-			while (j < n && pattern[j] != ']') {
-				j += 1;
-			}
-			if (j >= n) {
-				result_string += "\\[";
-			} else {
-				auto stuff = pattern.substr(i, j);
-				if (stuff.find("--") == String::npos) {
-					stuff.replace(String{ "\\" }, String{ R"(\\)" });
-				} else {
-					Vector<String> chunks;
-					std::size_t k = 0;
-					if (pattern[i] == '!') {
-						k = i + 2;
-					} else {
-						k = i + 1;
-					}
-
-					while (true) {
-						size_t off = k;
-						k = pattern.substr(off, j).find("-");
-						if (k == -1) {
-							break;
-						}
-						k += off;
-						chunks.push_back(pattern.substr(i, k));
-						i = k + 1;
-						k = k + 3;
-					}
-
-					chunks.push_back(pattern.substr(i, j));
-					// Escape backslashes and hyphens for set difference (--).
-					// Hyphens that create ranges shouldn't be escaped.
-					bool first = true;
-					for (auto &s : chunks) {
-						s.replace(String{ "\\" }, String{ R"(\\)" });
-						s.replace(String{ "-" }, String{ R"(\-)" });
-						if (first) {
-							stuff += s;
-							first = false;
-						} else {
-							stuff += "-" + s;
-						}
-					}
-				}
-
-				// Escape set operations (&&, ~~ and ||).
-				String result;
-				Ref<RegEx> escapere = RegEx::create_from_string(R"([&~|])");
-				escapere->sub(stuff, R"(\\\1)", true);
-				stuff = result;
-				i = j + 1;
-				if (stuff[0] == '!') {
-					stuff = "^" + stuff.substr(1);
-				} else if (stuff[0] == '^' || stuff[0] == '[') {
-					stuff = "\\\\" + stuff;
-				}
-				result_string = result_string + "[" + stuff + "]";
-			}
-		} else {
-			if (special_characters.find_char(c) != String::npos) {
-				result_string += special_characters_map[static_cast<char32_t>(c)];
-			} else {
-				result_string += c;
-			}
-		}
-	}
-	return String{ "((" } + result_string + String{ R"()|[\r\n])$)" };
+	return da->file_exists(basename) || da->dir_exists(basename);
 }
 
 Vector<String> filter(const Vector<String> &names,
 		const String &pattern) {
 	// std::cout << "Pattern: " << pattern << "\n";
 	Vector<String> result;
+	const GlobPattern compiled(pattern);
 	for (auto &name : names) {
 		// std::cout << "Checking for " << name.string() << "\n";
-		if (Glob::fnmatch(name, pattern)) {
+		if (compiled.match(name)) {
 			result.push_back(name);
 		}
 	}
@@ -180,10 +107,13 @@ Vector<String> filter(const Vector<String> &names,
 }
 
 bool has_magic(const String &pathname) {
-	// static const auto magic_check = std::regex("([*?[])");
-	// return std::regex_search(pathname.utf8().get_data(), magic_check);
-	static const Ref<RegEx> magic_check = RegEx::create_from_string("([*?[])");
-	return magic_check->search(pathname).is_valid();
+	const char32_t *str = pathname.ptr();
+	for (int i = 0; i < pathname.length(); i++) {
+		if (str[i] == '*' || str[i] == '?' || str[i] == '[') {
+			return true;
+		}
+	}
+	return false;
 }
 
 bool is_hidden(const String &pathname) {
@@ -194,16 +124,14 @@ bool is_recursive(const String &pattern) {
 	return pattern == "**";
 }
 
-Vector<String> iter_directory(const String &dir, bool dironly, bool include_hidden) {
-	Error err;
-	Ref<DirAccess> da = DirAccess::open(dir, &err);
-	if (da.is_null()) {
+Vector<String> iter_directory(const String &dir, bool dironly, DirCache &cache) {
+	auto listing = cache.list(dir);
+	if (!listing) {
 		return Vector<String>(); // fail silently
 	}
-	da->set_include_hidden(include_hidden);
-	Vector<String> ret = da->get_directories();
+	Vector<String> ret = listing->dirs;
 	if (!dironly) {
-		ret.append_array(da->get_files());
+		ret.append_array(listing->files);
 	}
 	if (dir.is_absolute_path()) {
 		for (int i = 0; i < ret.size(); i++) {
@@ -214,13 +142,13 @@ Vector<String> iter_directory(const String &dir, bool dironly, bool include_hidd
 }
 
 // Recursively yields relative pathnames inside a literal directory.
-Vector<String> rlistdir(const String &dirname, bool dironly, bool include_hidden) {
+Vector<String> rlistdir(const String &dirname, bool dironly, DirCache &cache) {
 	Vector<String> result;
 
-	auto names = iter_directory(dirname, dironly, include_hidden);
+	auto names = iter_directory(dirname, dironly, cache);
 	for (auto &x : names) {
 		result.push_back(x);
-		for (auto &y : rlistdir(x, dironly, include_hidden)) {
+		for (auto &y : rlistdir(x, dironly, cache)) {
 			if (!dirname.is_absolute_path()) {
 				y = x.path_join(y);
 			}
@@ -233,11 +161,11 @@ Vector<String> rlistdir(const String &dirname, bool dironly, bool include_hidden
 // This helper function recursively yields relative pathnames inside a literal
 // directory.
 Vector<String> glob2(const String &dirname, [[maybe_unused]] const String &pattern,
-		bool dironly, bool include_hidden) {
+		bool dironly, DirCache &cache) {
 	// std::cout << "In glob2\n";
 	Vector<String> result;
 	//assert(is_recursive(pattern));
-	for (auto &dir : rlistdir(dirname, dironly, include_hidden)) {
+	for (auto &dir : rlistdir(dirname, dironly, cache)) {
 		result.push_back(dir);
 	}
 	return result;
@@ -248,9 +176,9 @@ Vector<String> glob2(const String &dirname, [[maybe_unused]] const String &patte
 // takes a literal basename (so it only has to check for its existence).
 
 Vector<String> glob1(const String &dirname, const String &pattern,
-		bool dironly, bool include_hidden) {
+		bool dironly, DirCache &cache) {
 	// std::cout << "In glob1\n";
-	auto names = iter_directory(dirname, dironly, include_hidden);
+	auto names = iter_directory(dirname, dironly, cache);
 	Vector<String> filtered_names;
 	for (auto &n : names) {
 		if (!is_hidden(n)) {
@@ -261,16 +189,16 @@ Vector<String> glob1(const String &dirname, const String &pattern,
 }
 
 Vector<String> glob0(const String &dirname, const String &basename,
-		bool dironly, bool include_hidden) {
+		bool dironly, DirCache &cache) {
 	// std::cout << "In glob0\n";
 	Vector<String> result;
 	if (basename.is_empty()) {
 		// 'q*x/' should match only directories.
-		if (dir_exists(dirname, include_hidden)) {
+		if (dir_exists(dirname, cache)) {
 			result = { basename };
 		}
 	} else {
-		if (dir_or_file_exists(dirname.path_join(basename), include_hidden)) {
+		if (dir_or_file_exists(dirname.path_join(basename), cache)) {
 			result = { basename };
 		}
 	}
@@ -300,8 +228,8 @@ String expand_tilde(String path) {
 	}
 }
 
-Vector<String> _glob(const String &inpath, bool recursive = false,
-		bool dironly = false, bool include_hidden = false) {
+Vector<String> _glob(const String &inpath, DirCache &cache, bool recursive = false,
+		bool dironly = false) {
 	Vector<String> result;
 
 	String path = inpath;
@@ -317,12 +245,12 @@ Vector<String> _glob(const String &inpath, bool recursive = false,
 	if (!has_magic(path)) {
 		//assert(!dironly);
 		if (!basename.is_empty()) {
-			if (dir_or_file_exists(path, include_hidden)) {
+			if (dir_or_file_exists(path, cache)) {
 				result.push_back(path);
 			}
 		} else {
 			// Patterns ending with a slash should match only directories
-			if (dir_exists(dirname, include_hidden)) {
+			if (dir_exists(dirname, cache)) {
 				result.push_back(path);
 			}
 		}
@@ -331,20 +259,20 @@ Vector<String> _glob(const String &inpath, bool recursive = false,
 
 	if (dirname.is_empty()) {
 		if (recursive && is_recursive(basename)) {
-			return glob2(dirname, basename, dironly, include_hidden);
+			return glob2(dirname, basename, dironly, cache);
 		} else {
-			return glob1(dirname, basename, dironly, include_hidden);
+			return glob1(dirname, basename, dironly, cache);
 		}
 	}
 
 	Vector<String> dirs;
 	if (dirname != path && has_magic(dirname)) {
-		dirs = _glob(dirname, recursive, true, include_hidden);
+		dirs = _glob(dirname, cache, recursive, true);
 	} else {
 		dirs = { dirname };
 	}
 
-	std::function<Vector<String>(const String &, const String &, bool, bool)>
+	std::function<Vector<String>(const String &, const String &, bool, DirCache &)>
 			glob_in_dir;
 	if (has_magic(basename)) {
 		if (recursive && is_recursive(basename)) {
@@ -357,7 +285,7 @@ Vector<String> _glob(const String &inpath, bool recursive = false,
 	}
 
 	for (auto &d : dirs) {
-		for (auto &name : glob_in_dir(d, basename, dironly, include_hidden)) {
+		for (auto &name : glob_in_dir(d, basename, dironly, cache)) {
 			String subresult = name;
 			if (name.get_base_dir().is_empty()) {
 				subresult = d.path_join(name);
@@ -371,22 +299,215 @@ Vector<String> _glob(const String &inpath, bool recursive = false,
 
 } //namespace
 
+bool GlobPattern::CharClass::has(char32_t p_char) const {
+	for (int i = 0; i < ranges.size(); i++) {
+		if (p_char >= ranges[i].first && p_char <= ranges[i].second) {
+			return !negated;
+		}
+	}
+	return negated;
+}
+
+GlobPattern::GlobPattern(const String &p_pattern, bool p_char_classes) {
+	const char32_t *p = p_pattern.ptr();
+	const int n = p_pattern.length();
+	Segment current;
+	for (int i = 0; i < n; i++) {
+		Element e;
+		const char32_t c = p[i];
+		if (c == '*') {
+			// runs of stars and the empty segments between them don't change what matches
+			if (!has_star || current.size() > 0) {
+				segments.push_back(current);
+			}
+			has_star = true;
+			current = Segment();
+			continue;
+		} else if (c == '?') {
+			// String::match's '?' doesn't match '.'
+			e.type = p_char_classes ? Element::ANY : Element::ANY_BUT_PERIOD;
+		} else if (c == '[' && p_char_classes) {
+			int j = i + 1;
+			CharClass char_class;
+			if (j < n && p[j] == '!') {
+				char_class.negated = true;
+				j++;
+			}
+			const int first = j;
+			// a ']' right after the opening bracket is part of the set
+			if (j < n && p[j] == ']') {
+				j++;
+			}
+			while (j < n && p[j] != ']') {
+				j++;
+			}
+			if (j >= n) {
+				// no closing bracket, the '[' is a literal
+				e.c = c;
+			} else {
+				for (int k = first; k < j; k++) {
+					char32_t lo = p[k];
+					char32_t hi = lo;
+					if (k + 2 < j && p[k + 1] == '-') {
+						hi = p[k + 2];
+						k += 2;
+					}
+					// empty ranges (e.g. "z-a") never match
+					if (lo <= hi) {
+						char_class.ranges.push_back(Pair<char32_t, char32_t>(lo, hi));
+					}
+				}
+				e.type = Element::CLASS;
+				e.char_class = char_classes.size();
+				char_classes.push_back(char_class);
+				i = j;
+			}
+		} else {
+			e.c = c;
+		}
+		if (e.type == Element::CHAR) {
+			current.literal += e.c;
+		} else {
+			current.is_literal = false;
+		}
+		current.elements.push_back(e);
+	}
+	segments.push_back(current);
+	for (int i = 0; i < segments.size(); i++) {
+		min_length += segments[i].size();
+	}
+}
+
+bool GlobPattern::_match_segment(const Segment &p_segment, const char32_t *p_str) const {
+	const Element *elements = p_segment.elements.ptr();
+	for (int i = 0; i < p_segment.size(); i++) {
+		switch (elements[i].type) {
+			case Element::CHAR:
+				if (p_str[i] != elements[i].c) {
+					return false;
+				}
+				break;
+			case Element::ANY:
+				break;
+			case Element::ANY_BUT_PERIOD:
+				if (p_str[i] == '.') {
+					return false;
+				}
+				break;
+			case Element::CLASS:
+				if (!char_classes[elements[i].char_class].has(p_str[i])) {
+					return false;
+				}
+				break;
+		}
+	}
+	return true;
+}
+
+bool GlobPattern::match(const String &p_name) const {
+	const int len = p_name.length();
+	const char32_t *str = p_name.ptr();
+	if (!has_star) {
+		return len == min_length && _match_segment(segments[0], str);
+	}
+	if (len < min_length) {
+		return false;
+	}
+	// check the anchored prefix and suffix before scanning for anything in between
+	const Segment &prefix = segments[0];
+	const Segment &suffix = segments[segments.size() - 1];
+	if (!_match_segment(prefix, str) || !_match_segment(suffix, str + len - suffix.size())) {
+		return false;
+	}
+	int pos = prefix.size();
+	const int end = len - suffix.size();
+	for (int i = 1; i < segments.size() - 1; i++) {
+		const Segment &segment = segments[i];
+		const int last_start = end - segment.size();
+		if (segment.is_literal) {
+			int found = p_name.find(segment.literal, pos);
+			if (found == -1 || found > last_start) {
+				return false;
+			}
+			pos = found;
+		} else {
+			while (pos <= last_start && !_match_segment(segment, str + pos)) {
+				pos++;
+			}
+			if (pos > last_start) {
+				return false;
+			}
+		}
+		pos += segment.size();
+	}
+	return true;
+}
+
+bool GlobPattern::is_literal() const {
+	return !has_star && segments[0].is_literal;
+}
+
+String GlobPattern::get_literal() const {
+	return is_literal() ? segments[0].literal : String();
+}
+
+GlobPatternSet::GlobPatternSet(const Vector<String> &p_patterns, bool p_char_classes) {
+	for (int i = 0; i < p_patterns.size(); i++) {
+		GlobPattern pattern(p_patterns[i], p_char_classes);
+		if (pattern.is_literal()) {
+			literals.insert(pattern.get_literal());
+		} else {
+			patterns.push_back(pattern);
+		}
+	}
+}
+
+bool GlobPatternSet::match(const String &p_name) const {
+	if (literals.has(p_name)) {
+		return true;
+	}
+	for (int i = 0; i < patterns.size(); i++) {
+		if (patterns[i].match(p_name)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool GlobPatternSet::is_empty() const {
+	return literals.is_empty() && patterns.is_empty();
+}
+
 bool Glob::fnmatch(const String &name, const String &pattern) {
-	return RegEx::create_from_string(translate(pattern))->search(name).is_valid();
+	return GlobPattern(pattern).match(name);
+}
+
+Vector<String> Glob::fnmatch_list(const Vector<String> &names, const Vector<String> &patterns) {
+	Vector<String> result;
+	const GlobPatternSet pattern_set(patterns);
+	for (auto &name : names) {
+		if (pattern_set.match(name)) {
+			result.push_back(name);
+		}
+	}
+	return result;
 }
 
 Vector<String> Glob::glob(const String &pathname, bool hidden) {
-	return _glob(pathname, false, hidden);
+	DirCache cache(hidden);
+	return _glob(pathname, cache, false);
 }
 
 Vector<String> Glob::rglob(const String &pathname, bool hidden) {
-	return _glob(pathname, true, hidden);
+	DirCache cache(hidden);
+	return _glob(pathname, cache, true);
 }
 
 Vector<String> Glob::glob_list(const Vector<String> &pathnames, bool hidden) {
 	Vector<String> result;
+	DirCache cache(hidden);
 	for (auto &pathname : pathnames) {
-		for (auto &match : _glob(pathname, false, hidden)) {
+		for (auto &match : _glob(pathname, cache, false)) {
 			result.push_back(std::move(match));
 		}
 	}
@@ -395,8 +516,9 @@ Vector<String> Glob::glob_list(const Vector<String> &pathnames, bool hidden) {
 
 Vector<String> Glob::rglob_list(const Vector<String> &pathnames, bool hidden) {
 	Vector<String> result;
+	DirCache cache(hidden);
 	for (auto &pathname : pathnames) {
-		for (auto &match : _glob(pathname, true, hidden)) {
+		for (auto &match : _glob(pathname, cache, true)) {
 			result.push_back(std::move(match));
 		}
 	}
@@ -409,4 +531,5 @@ void Glob::_bind_methods() {
 	ClassDB::bind_static_method(get_class_static(), D_METHOD("glob_list", "pathnames", "hidden"), &Glob::glob_list, DEFVAL(false));
 	ClassDB::bind_static_method(get_class_static(), D_METHOD("rglob_list", "pathnames", "hidden"), &Glob::rglob_list, DEFVAL(false));
 	ClassDB::bind_static_method(get_class_static(), D_METHOD("fnmatch", "name", "pattern"), &Glob::fnmatch);
+	ClassDB::bind_static_method(get_class_static(), D_METHOD("fnmatch_list", "names", "patterns"), &Glob::fnmatch_list);
 }
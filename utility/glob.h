@@ -27,8 +27,77 @@
 #include "core/object/class_db.h"
 #include "core/object/object.h"
 #include "core/string/ustring.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/pair.h"
 #include "core/templates/vector.h"
 #include "modules/regex/regex.h"
+
+/// A glob pattern compiled once for matching against many names.
+///
+/// The pattern is split on '*' into fixed-length segments; the first and last segments are anchored to
+/// the start and end of the name and the ones in between are matched at their leftmost position.
+/// If `p_char_classes` is set, `?` matches any single character and `[seq]`/`[!seq]` match a character (not) in seq,
+/// like fnmatch. If it is unset, `[` is a literal and `?` matches any character except '.', the same semantics as
+/// `String::match`.
+class GlobPattern {
+	struct CharClass {
+		bool negated = false;
+		Vector<Pair<char32_t, char32_t>> ranges;
+
+		bool has(char32_t p_char) const;
+	};
+
+	struct Element {
+		enum Type : uint8_t {
+			CHAR,
+			ANY,
+			ANY_BUT_PERIOD,
+			CLASS,
+		};
+		Type type = CHAR;
+		char32_t c = 0;
+		int char_class = -1;
+	};
+
+	struct Segment {
+		Vector<Element> elements;
+		bool is_literal = true;
+		String literal;
+
+		_FORCE_INLINE_ int size() const { return elements.size(); }
+	};
+
+	// if has_star, the first and last segments are the (possibly empty) prefix and suffix
+	Vector<Segment> segments;
+	Vector<CharClass> char_classes;
+	bool has_star = false;
+	int min_length = 0;
+
+	bool _match_segment(const Segment &p_segment, const char32_t *p_str) const;
+
+public:
+	bool match(const String &p_name) const;
+	/// True if the pattern has no wildcards, in which case it only matches `get_literal()`
+	bool is_literal() const;
+	String get_literal() const;
+
+	GlobPattern(const String &p_pattern = String(), bool p_char_classes = true);
+};
+
+/// A set of glob patterns that are tested together against each name.
+/// Patterns without wildcards are looked up in a hash set, the rest are compiled to `GlobPattern`s.
+class GlobPatternSet {
+	HashSet<String> literals;
+	Vector<GlobPattern> patterns;
+
+public:
+	/// Returns true if `p_name` matches any of the patterns
+	bool match(const String &p_name) const;
+	bool is_empty() const;
+
+	GlobPatternSet(const Vector<String> &p_patterns = Vector<String>(), bool p_char_classes = true);
+};
+
 class Glob : public Object {
 	GDCLASS(Glob, Object);
 
@@ -60,4 +129,7 @@ public:
 
 	/// Returns true if the input path matche the glob pattern
 	static bool fnmatch(const String &name, const String &pattern);
+
+	/// Returns the names that match any of the glob patterns, compiling each pattern only once
+	static Vector<String> fnmatch_list(const Vector<String> &names, const Vector<String> &patterns);
 }; // namespace glob
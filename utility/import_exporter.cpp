@@ -27,6 +27,8 @@
 #include "scene/resources/font.h"
 #include "thirdparty/minimp3/minimp3_ex.h"
 
+thread_local ImportExporter::ExportToken *ImportExporter::current_export_token = nullptr;
+
 GDRESettings *get_settings() {
 	return GDRESettings::get_singleton();
 }
@@ -53,7 +55,6 @@ Error ImportExporter::_export_imports(const String &p_out_dir, const Vector<Stri
 	ERR_FAIL_COND_V_MSG(!get_settings()->is_pack_loaded(), ERR_DOES_NOT_EXIST, "pack/dir not loaded!");
 	uint64_t last_progress_upd = OS::get_singleton()->get_ticks_usec();
 	String output_dir = !p_out_dir.is_empty() ? p_out_dir : get_settings()->get_project_path();
-	Error err = OK;
 	if (opt_lossy) {
 		WARN_PRINT_ONCE("Converting lossy imports, you may lose fidelity for indicated assets when re-importing upon loading the project");
 	}
@@ -67,241 +68,321 @@ Error ImportExporter::_export_imports(const String &p_out_dir, const Vector<Stri
 		// This only works if we decompile the scripts first
 		recreate_plugin_configs(output_dir);
 	}
+	// ***** Gather export tasks *****
+	// If files_to_export is empty, then we export everything
+	HashSet<ImportInfo *> to_export;
+	if (partial_export) {
+		Array selected = get_settings()->get_import_infos(files_to_export);
+		for (int i = 0; i < selected.size(); i++) {
+			Ref<ImportInfo> iinfo = selected[i];
+			to_export.insert(iinfo.ptr());
+		}
+	}
+	Vector<ExportToken> tokens;
 	for (int i = 0; i < files.size(); i++) {
 		Ref<ImportInfo> iinfo = files[i];
 		String path = iinfo->get_path();
-		String source = iinfo->get_source_file();
-		String type = iinfo->get_type();
-		String importer = iinfo->get_importer();
-		auto loss_type = iinfo->get_import_loss_type();
-		// If files_to_export is empty, then we export everything
-		if (partial_export) {
-			auto dest_files = iinfo->get_dest_files();
-			bool has_path = false;
-			for (auto dest : dest_files) {
-				if (files_to_export.has(path)) {
-					has_path = true;
-					break;
-				}
-			}
-			if (!has_path) {
-				continue;
-			}
-		}
-		if (pr) {
-			if (OS::get_singleton()->get_ticks_usec() - last_progress_upd > 10000) {
-				last_progress_upd = OS::get_singleton()->get_ticks_usec();
-				bool cancel = pr->step(path, i, true);
-				if (cancel) {
-					return ERR_PRINTER_ON_FIRE;
-				}
-			}
+		if (partial_export && !to_export.has(iinfo.ptr())) {
+			continue;
 		}
-		if (loss_type != ImportInfo::LOSSLESS) {
+		ExportToken token;
+		token.iinfo = iinfo;
+		token.output_dir = output_dir;
+		if (iinfo->get_import_loss_type() != ImportInfo::LOSSLESS) {
 			if (!opt_lossy) {
-				lossy_imports.push_back(iinfo);
 				print_line("Not converting lossy import " + path);
-				continue;
+				token.skipped_lossy = true;
 			}
 		}
-		// ***** Set export destination *****
-		iinfo->set_export_dest(iinfo->get_source_file());
-		bool should_rewrite_metadata = false;
-		// This is a Godot asset that was imported outside of project directory
-		if (!iinfo->get_source_file().begins_with("res://")) {
-			if (get_ver_major() <= 2) {
-				// import_md_path is the resource path in v2
-				iinfo->set_export_dest(String("res://.assets").path_join(iinfo->get_import_md_path().get_base_dir().path_join(iinfo->get_source_file().get_file()).replace("res://", "")));
-			} else {
-				// import_md_path is the .import/.remap path in v3-v4
-				iinfo->set_export_dest(iinfo->get_import_md_path().get_basename());
-				// If the source_file path was not actually in the project structure, save it elsewhere
-				if (iinfo->get_source_file().find(iinfo->get_export_dest().replace("res://", "")) == -1) {
-					iinfo->set_export_dest(iinfo->get_export_dest().replace("res://", "res://.assets"));
+		tokens.push_back(token);
+	}
+
+	// ***** Export resources *****
+	export_cancelled.clear();
+	export_tasks_completed.set(0);
+	int num_jobs = _get_num_jobs(tokens.size());
+	if (num_jobs <= 1) {
+		// run serially on this thread
+		for (int i = 0; i < tokens.size(); i++) {
+			if (pr) {
+				if (OS::get_singleton()->get_ticks_usec() - last_progress_upd > 10000) {
+					last_progress_upd = OS::get_singleton()->get_ticks_usec();
+					if (pr->step(tokens[i].iinfo->get_path(), i, true)) {
+						return ERR_PRINTER_ON_FIRE;
+					}
 				}
 			}
-			should_rewrite_metadata = true;
+			_do_export(i, tokens.ptrw());
 		}
-		String src_ext = iinfo->get_source_file().get_extension().to_lower();
-		bool not_exported = false;
-		// ***** Export resource *****
-		if (opt_export_textures && importer == "texture") {
-			// Right now we only convert 2d image textures
-			auto tex_type = TextureLoaderCompat::recognize(path, &err);
-			switch (tex_type) {
-				case TextureLoaderCompat::FORMAT_V2_IMAGE_TEXTURE:
-				case TextureLoaderCompat::FORMAT_V3_STREAM_TEXTURE2D:
-				case TextureLoaderCompat::FORMAT_V4_COMPRESSED_TEXTURE2D: {
-					// Export texture
-					err = export_texture(output_dir, iinfo);
-				} break;
-				case TextureLoaderCompat::FORMAT_NOT_TEXTURE:
-					if (err == ERR_FILE_UNRECOGNIZED) {
-						WARN_PRINT("Import of type " + type + " is not a texture(?): " + path);
-					} else {
-						WARN_PRINT("Failed to load texture " + type + " " + path);
-					}
-					not_converted.push_back(iinfo);
-					break;
-				default:
-					report_unsupported_resource(type, src_ext, path);
-					not_converted.push_back(iinfo);
-					not_exported = true;
-			}
-		} else if (opt_export_samples && (importer == "sample" || importer == "wav")) {
-			err = export_sample(output_dir, iinfo);
-		} else if (opt_export_ogg && (importer == "ogg_vorbis" || importer == "oggvorbisstr")) {
-			err = convert_oggstr_to_ogg(output_dir, iinfo->get_path(), iinfo->get_export_dest());
-		} else if (opt_export_mp3 && importer == "mp3") {
-			err = convert_mp3str_to_mp3(output_dir, iinfo->get_path(), iinfo->get_export_dest());
-		} else if (importer == "bitmap") {
-			err = export_texture(output_dir, iinfo);
-		} else if ((opt_bin2text && iinfo->is_auto_converted())
-				//|| (opt_bin2text && iinfo->get_source_file().get_extension() == "tres" && iinfo->get_source_file().get_extension() == "res") ||
-				// (opt_bin2text && iinfo->get_importer() == "scene" && iinfo->get_source_file().get_extension() == "tscn")
-		) {
-			// We don't currently support converting old 2.x xml resources
-			if (src_ext == "xml") {
-				WARN_PRINT_ONCE("Conversion of Godot 2.x xml resource files currently unimplemented");
-				report_unsupported_resource(type, src_ext, path);
-				not_converted.push_back(iinfo);
-				not_exported = true;
+	} else {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(
+				this,
+				&ImportExporter::_do_export,
+				tokens.ptrw(),
+				tokens.size(), num_jobs, true, SNAME("ImportExporter::export_imports"));
+		while (!WorkerThreadPool::get_singleton()->is_group_task_completed(group_task)) {
+			OS::get_singleton()->delay_usec(10000);
+			if (pr && !export_cancelled.is_set()) {
+				int completed = MIN((int)export_tasks_completed.get(), tokens.size() - 1);
+				if (pr->step(tokens[completed].iinfo->get_path(), completed, true)) {
+					// tasks that have not yet started will bail out immediately
+					export_cancelled.set();
+				}
 			}
-			err = convert_res_bin_2_txt(output_dir, iinfo->get_path(), iinfo->get_export_dest());
-			// v2-v3 export left the autoconverted resource in the main path, remove it
-			if (get_ver_major() <= 3 && !err) {
-				dir->remove(iinfo->get_path().replace("res://", ""));
+		}
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		if (export_cancelled.is_set()) {
+			return ERR_PRINTER_ON_FIRE;
+		}
+	}
+
+	// ***** Rewrite metadata and record results *****
+	// This is done serially and in the original import order so that the output is the same regardless of job count
+	for (int i = 0; i < tokens.size(); i++) {
+		_finish_export(tokens.write[i], dir);
+	}
+	if (get_settings()->is_project_config_loaded()) { // some pcks do not have project configs
+		if (get_settings()->save_project_config(output_dir) != OK) {
+			print_line("ERROR: Failed to save project config!");
+		} else {
+			// Remove binary project config, as editors will load from it instead of the text one
+			dir->remove(get_settings()->get_project_config_path().get_file());
+		}
+	}
+	print_report();
+	return OK;
+}
+
+int ImportExporter::_get_num_jobs(int p_num_items) const {
+	int num_jobs = opt_num_jobs;
+	if (num_jobs <= 0 || num_jobs > WorkerThreadPool::get_singleton()->get_thread_count()) {
+		num_jobs = WorkerThreadPool::get_singleton()->get_thread_count();
+	}
+	return CLAMP(num_jobs, 1, MAX(p_num_items, 1));
+}
+
+// Exports a single resource; called from the worker thread pool, so this must not touch the result lists
+void ImportExporter::_do_export(uint32_t i, ExportToken *tokens) {
+	ExportToken &token = tokens[i];
+	if (token.skipped_lossy || export_cancelled.is_set()) {
+		export_tasks_completed.increment();
+		return;
+	}
+	current_export_token = &token;
+	Ref<ImportInfo> iinfo = token.iinfo;
+	const String &output_dir = token.output_dir;
+	String path = iinfo->get_path();
+	String type = iinfo->get_type();
+	String importer = iinfo->get_importer();
+	Error err = OK;
+	// ***** Set export destination *****
+	iinfo->set_export_dest(iinfo->get_source_file());
+	// This is a Godot asset that was imported outside of project directory
+	if (!iinfo->get_source_file().begins_with("res://")) {
+		if (get_ver_major() <= 2) {
+			// import_md_path is the resource path in v2
+			iinfo->set_export_dest(String("res://.assets").path_join(iinfo->get_import_md_path().get_base_dir().path_join(iinfo->get_source_file().get_file()).replace("res://", "")));
+		} else {
+			// import_md_path is the .import/.remap path in v3-v4
+			iinfo->set_export_dest(iinfo->get_import_md_path().get_basename());
+			// If the source_file path was not actually in the project structure, save it elsewhere
+			if (iinfo->get_source_file().find(iinfo->get_export_dest().replace("res://", "")) == -1) {
+				iinfo->set_export_dest(iinfo->get_export_dest().replace("res://", "res://.assets"));
 			}
-		} else if (importer == "scene" && !iinfo->is_auto_converted()) {
-			// escn files are scenes exported from a blender plugin in a godot compatible format
-			// These are the only ones we support at the moment
-			if (src_ext == "escn") {
-				err = convert_res_bin_2_txt(output_dir, iinfo->get_path(), iinfo->get_export_dest());
-			} else {
-				WARN_PRINT_ONCE("Export of models/imported scenes currently unimplemented");
+		}
+		token.should_rewrite_metadata = true;
+	}
+	String src_ext = iinfo->get_source_file().get_extension().to_lower();
+	// ***** Export resource *****
+	if (opt_export_textures && importer == "texture") {
+		// Right now we only convert 2d image textures
+		auto tex_type = TextureLoaderCompat::recognize(path, &err);
+		switch (tex_type) {
+			case TextureLoaderCompat::FORMAT_V2_IMAGE_TEXTURE:
+			case TextureLoaderCompat::FORMAT_V3_STREAM_TEXTURE2D:
+			case TextureLoaderCompat::FORMAT_V4_COMPRESSED_TEXTURE2D: {
+				// Export texture
+				err = export_texture(output_dir, iinfo);
+			} break;
+			case TextureLoaderCompat::FORMAT_NOT_TEXTURE:
+				if (err == ERR_FILE_UNRECOGNIZED) {
+					WARN_PRINT("Import of type " + type + " is not a texture(?): " + path);
+				} else {
+					WARN_PRINT("Failed to load texture " + type + " " + path);
+				}
+				token.not_converted = true;
+				break;
+			default:
 				report_unsupported_resource(type, src_ext, path);
-				not_converted.push_back(iinfo);
-				not_exported = true;
-			}
-		} else if (importer == "font_data_dynamic") {
-			err = export_fontfile(output_dir, iinfo);
-		} else if (importer == "csv_translation") {
-			err = export_translation(output_dir, iinfo);
-		} else if (importer == "wavefront_obj") {
-			WARN_PRINT_ONCE("Export of obj meshes currently unimplemented");
+				token.not_converted = true;
+				token.not_exported = true;
+		}
+	} else if (opt_export_samples && (importer == "sample" || importer == "wav")) {
+		err = export_sample(output_dir, iinfo);
+	} else if (opt_export_ogg && (importer == "ogg_vorbis" || importer == "oggvorbisstr")) {
+		err = convert_oggstr_to_ogg(output_dir, iinfo->get_path(), iinfo->get_export_dest());
+	} else if (opt_export_mp3 && importer == "mp3") {
+		err = convert_mp3str_to_mp3(output_dir, iinfo->get_path(), iinfo->get_export_dest());
+	} else if (importer == "bitmap") {
+		err = export_texture(output_dir, iinfo);
+	} else if ((opt_bin2text && iinfo->is_auto_converted())
+			//|| (opt_bin2text && iinfo->get_source_file().get_extension() == "tres" && iinfo->get_source_file().get_extension() == "res") ||
+			// (opt_bin2text && iinfo->get_importer() == "scene" && iinfo->get_source_file().get_extension() == "tscn")
+	) {
+		// We don't currently support converting old 2.x xml resources
+		if (src_ext == "xml") {
+			WARN_PRINT_ONCE("Conversion of Godot 2.x xml resource files currently unimplemented");
 			report_unsupported_resource(type, src_ext, path);
-			not_converted.push_back(iinfo);
-			not_exported = true;
+			token.not_converted = true;
+			token.not_exported = true;
+		}
+		err = convert_res_bin_2_txt(output_dir, iinfo->get_path(), iinfo->get_export_dest());
+		// v2-v3 export left the autoconverted resource in the main path, remove it (after all the tasks are done,
+		// other resources being converted may still reference it)
+		if (get_ver_major() <= 3 && !err) {
+			token.remove_autoconverted = true;
+		}
+	} else if (importer == "scene" && !iinfo->is_auto_converted()) {
+		// escn files are scenes exported from a blender plugin in a godot compatible format
+		// These are the only ones we support at the moment
+		if (src_ext == "escn") {
+			err = convert_res_bin_2_txt(output_dir, iinfo->get_path(), iinfo->get_export_dest());
 		} else {
+			WARN_PRINT_ONCE("Export of models/imported scenes currently unimplemented");
 			report_unsupported_resource(type, src_ext, path);
-			not_converted.push_back(iinfo);
-			not_exported = true;
+			token.not_converted = true;
+			token.not_exported = true;
 		}
+	} else if (importer == "font_data_dynamic") {
+		err = export_fontfile(output_dir, iinfo);
+	} else if (importer == "csv_translation") {
+		err = export_translation(output_dir, iinfo);
+	} else if (importer == "wavefront_obj") {
+		WARN_PRINT_ONCE("Export of obj meshes currently unimplemented");
+		report_unsupported_resource(type, src_ext, path);
+		token.not_converted = true;
+		token.not_exported = true;
+	} else {
+		report_unsupported_resource(type, src_ext, path);
+		token.not_converted = true;
+		token.not_exported = true;
+	}
+	token.err = err;
+	current_export_token = nullptr;
+	export_tasks_completed.increment();
+}
 
-		// ****REWRITE METADATA****
-		if (err == ERR_PRINTER_ON_FIRE || ((err == OK && should_rewrite_metadata) && iinfo->is_import())) {
-			if (iinfo->get_ver_major() <= 2 && opt_rewrite_imd_v2) {
-				// TODO: handle v2 imports with more than one source, like atlas textures
-				err = rewrite_import_source(iinfo->get_export_dest(), output_dir, iinfo);
-			} else if (iinfo->get_ver_major() >= 3 && opt_rewrite_imd_v3 && (iinfo->get_source_file().find(iinfo->get_export_dest().replace("res://", "")) != -1)) {
-				// Currently, we only rewrite the import data for v3 if the source file was somehow recorded as an absolute file path,
-				// But is still in the project structure
-				err = rewrite_import_source(iinfo->get_export_dest(), output_dir, iinfo);
-			} else if (iinfo->is_dirty()) {
-				err = iinfo->save_to(output_dir.path_join(iinfo->get_import_md_path().replace("res://", "")));
-			}
-			// if we didn't rewrite the metadata, the err will still be ERR_PRINTER_ON_FIRE
-			// if we failed, it won't be OK
-			if (err != OK) {
-				if (err == ERR_PRINTER_ON_FIRE) {
-					print_line("Did not rewrite import metadata for " + iinfo->get_source_file());
-				} else {
-					print_line("Failed to rewrite import metadata for " + iinfo->get_source_file());
-				}
-				err = ERR_DATABASE_CANT_WRITE;
-			} else {
-				// we successfully rewrote the import data
-				err = ERR_PRINTER_ON_FIRE;
-			}
-			// saved to non-original path, but we exporter knows we can't rewrite the metadata
-		} else if (err == ERR_DATABASE_CANT_WRITE) {
-			print_line("Did not rewrite import metadata for " + iinfo->get_source_file());
-		} else if (err == OK && iinfo->is_dirty()) {
+void ImportExporter::_finish_export(ExportToken &token, Ref<DirAccess> &dir) {
+	Ref<ImportInfo> iinfo = token.iinfo;
+	const String &output_dir = token.output_dir;
+	String path = iinfo->get_path();
+	String type = iinfo->get_type();
+	auto loss_type = iinfo->get_import_loss_type();
+	Error err = token.err;
+	for (const Pair<String, String> &E : token.unsupported_types) {
+		_add_unsupported_type(E.first, E.second);
+	}
+	translation_export_message += token.translation_export_message;
+	if (token.skipped_lossy) {
+		lossy_imports.push_back(iinfo);
+		return;
+	}
+	if (token.not_converted) {
+		not_converted.push_back(iinfo);
+	}
+	if (token.remove_autoconverted) {
+		dir->remove(iinfo->get_path().replace("res://", ""));
+	}
+
+	// ****REWRITE METADATA****
+	if (err == ERR_PRINTER_ON_FIRE || ((err == OK && token.should_rewrite_metadata) && iinfo->is_import())) {
+		if (iinfo->get_ver_major() <= 2 && opt_rewrite_imd_v2) {
+			// TODO: handle v2 imports with more than one source, like atlas textures
+			err = rewrite_import_source(iinfo->get_export_dest(), output_dir, iinfo);
+		} else if (iinfo->get_ver_major() >= 3 && opt_rewrite_imd_v3 && (iinfo->get_source_file().find(iinfo->get_export_dest().replace("res://", "")) != -1)) {
+			// Currently, we only rewrite the import data for v3 if the source file was somehow recorded as an absolute file path,
+			// But is still in the project structure
+			err = rewrite_import_source(iinfo->get_export_dest(), output_dir, iinfo);
+		} else if (iinfo->is_dirty()) {
 			err = iinfo->save_to(output_dir.path_join(iinfo->get_import_md_path().replace("res://", "")));
-			if (err == OK) {
-				err = ERR_PRINTER_ON_FIRE;
+		}
+		// if we didn't rewrite the metadata, the err will still be ERR_PRINTER_ON_FIRE
+		// if we failed, it won't be OK
+		if (err != OK) {
+			if (err == ERR_PRINTER_ON_FIRE) {
+				print_line("Did not rewrite import metadata for " + iinfo->get_source_file());
 			} else {
 				print_line("Failed to rewrite import metadata for " + iinfo->get_source_file());
-				err = ERR_DATABASE_CANT_WRITE;
 			}
+			err = ERR_DATABASE_CANT_WRITE;
+		} else {
+			// we successfully rewrote the import data
+			err = ERR_PRINTER_ON_FIRE;
 		}
-
-		// We continue down here so that modified import metadata is saved
-		if (not_exported) {
-			continue;
+		// saved to non-original path, but we exporter knows we can't rewrite the metadata
+	} else if (err == ERR_DATABASE_CANT_WRITE) {
+		print_line("Did not rewrite import metadata for " + iinfo->get_source_file());
+	} else if (err == OK && iinfo->is_dirty()) {
+		err = iinfo->save_to(output_dir.path_join(iinfo->get_import_md_path().replace("res://", "")));
+		if (err == OK) {
+			err = ERR_PRINTER_ON_FIRE;
+		} else {
+			print_line("Failed to rewrite import metadata for " + iinfo->get_source_file());
+			err = ERR_DATABASE_CANT_WRITE;
 		}
+	}
 
-		// write md5 files
-		if (opt_write_md5_files && iinfo->is_import() && (err == OK || err == ERR_PRINTER_ON_FIRE) && get_ver_major() > 2) {
-			err = ((Ref<ImportInfoModern>)iinfo)->save_md5_file(output_dir);
-			if (err && err != ERR_PRINTER_ON_FIRE) {
-				err = ERR_LINK_FAILED;
-			} else {
-				err = OK;
-			}
-		}
-		// ***** Record export result *****
+	// We continue down here so that modified import metadata is saved
+	if (token.not_exported) {
+		return;
+	}
 
-		// the following are successful exports, but we failed to rewrite metadata or write md5 files
-		// we had to rewrite the import metadata
-		if (err == ERR_PRINTER_ON_FIRE) {
-			rewrote_metadata.push_back(iinfo);
-			err = OK;
-			// necessary to rewrite import metadata but failed
-		} else if (err == ERR_DATABASE_CANT_WRITE) {
-			failed_rewrite_md.push_back(iinfo);
-			err = OK;
-		} else if (err == ERR_LINK_FAILED) {
-			failed_rewrite_md5.push_back(iinfo);
+	// write md5 files
+	if (opt_write_md5_files && iinfo->is_import() && (err == OK || err == ERR_PRINTER_ON_FIRE) && get_ver_major() > 2) {
+		err = ((Ref<ImportInfoModern>)iinfo)->save_md5_file(output_dir);
+		if (err && err != ERR_PRINTER_ON_FIRE) {
+			err = ERR_LINK_FAILED;
+		} else {
 			err = OK;
 		}
+	}
+	// ***** Record export result *****
+
+	// the following are successful exports, but we failed to rewrite metadata or write md5 files
+	// we had to rewrite the import metadata
+	if (err == ERR_PRINTER_ON_FIRE) {
+		rewrote_metadata.push_back(iinfo);
+		err = OK;
+		// necessary to rewrite import metadata but failed
+	} else if (err == ERR_DATABASE_CANT_WRITE) {
+		failed_rewrite_md.push_back(iinfo);
+		err = OK;
+	} else if (err == ERR_LINK_FAILED) {
+		failed_rewrite_md5.push_back(iinfo);
+		err = OK;
+	}
 
-		if (err == ERR_UNAVAILABLE) {
-			// already reported in exporters below
-			not_converted.push_back(iinfo);
-		} else if (err != OK) {
-			failed.push_back(iinfo);
-			print_line("Failed to convert " + type + " resource " + path);
-		} else {
-			if (loss_type != ImportInfo::LOSSLESS) {
-				lossy_imports.push_back(iinfo);
-			}
-			success.push_back(iinfo);
-		}
-		// remove remaps
-		if (!err && get_settings()->has_any_remaps()) {
-			if (get_settings()->has_remap(iinfo->get_export_dest(), iinfo->get_path())) {
-				get_settings()->remove_remap(iinfo->get_export_dest(), iinfo->get_path(), output_dir);
-			}
+	if (err == ERR_UNAVAILABLE) {
+		// already reported in exporters below
+		not_converted.push_back(iinfo);
+	} else if (err != OK) {
+		failed.push_back(iinfo);
+		print_line("Failed to convert " + type + " resource " + path);
+	} else {
+		if (loss_type != ImportInfo::LOSSLESS) {
+			lossy_imports.push_back(iinfo);
 		}
+		success.push_back(iinfo);
 	}
-
-	if (get_settings()->is_project_config_loaded()) { // some pcks do not have project configs
-		if (get_settings()->save_project_config(output_dir) != OK) {
-			print_line("ERROR: Failed to save project config!");
-		} else {
-			// Remove binary project config, as editors will load from it instead of the text one
-			dir->remove(get_settings()->get_project_config_path().get_file());
+	// remove remaps
+	if (!err && get_settings()->has_any_remaps()) {
+		if (get_settings()->has_remap(iinfo->get_export_dest(), iinfo->get_path())) {
+			get_settings()->remove_remap(iinfo->get_export_dest(), iinfo->get_path(), output_dir);
 		}
 	}
-	print_report();
-	return OK;
 }
 
 Error ImportExporter::decompile_scripts(const String &p_out_dir) {
-	GDScriptDecomp *decomp;
-	// we have to remove remaps if they exist
-	bool has_remaps = get_settings()->has_any_remaps();
 	Vector<String> code_files = get_settings()->get_code_files();
 	if (code_files.is_empty()) {
 		return OK;
@@ -399,58 +480,86 @@ Error ImportExporter::decompile_scripts(const String &p_out_dir) {
 		default:
 			ERR_FAIL_V_MSG(ERR_FILE_UNRECOGNIZED, "Unknown version, failed to decompile");
 	}
-	if (revision > 0) {
-		decomp = create_decomp_for_commit(revision);
-	} else {
+	if (revision == 0) {
 		ERR_FAIL_V_MSG(ERR_FILE_UNRECOGNIZED, "Unknown version, failed to decompile");
 	}
+	// make sure that we actually have a decompiler for this revision before spinning up the workers
+	GDScriptDecomp *decomp = create_decomp_for_commit(revision);
+	ERR_FAIL_COND_V_MSG(!decomp, ERR_FILE_UNRECOGNIZED, "Unknown version, failed to decompile");
+	memdelete(decomp);
 
 	print_line("Script version " + get_settings()->get_version_string() + " (rev 0x" + String::num_int64(revision, 16) + ") detected");
+
+	ScriptDecompJob job;
+	job.revision = revision;
+	job.output_dir = p_out_dir;
+	job.key = get_settings()->get_encryption_key();
+	job.tokens.resize(code_files.size());
+	// create all the output directories up front instead of once per script
+	HashSet<String> dirs;
+	for (int i = 0; i < code_files.size(); i++) {
+		ScriptDecompToken &token = job.tokens.write[i];
+		token.path = code_files[i];
+		token.dest_file = token.path.replace(".gdc", ".gd").replace(".gde", ".gd");
+		token.encrypted = token.path.get_extension().to_lower() == "gde";
+		dirs.insert(p_out_dir.path_join(token.dest_file.get_base_dir().replace("res://", "")));
+	}
 	Error err;
-	for (String f : code_files) {
-		String dest_file = f.replace(".gdc", ".gd").replace(".gde", ".gd");
-		Ref<DirAccess> da = DirAccess::open(p_out_dir);
-		print_verbose("decompiling " + f);
-		bool encrypted = false;
-		if (f.get_extension().to_lower() == "gde") {
-			encrypted = true;
-			err = decomp->decompile_byte_code_encrypted(f, get_settings()->get_encryption_key());
-		} else {
-			err = decomp->decompile_byte_code(f);
-		}
-		if (err) {
-			memdelete(decomp);
+	for (const String &dir : dirs) {
+		err = ensure_dir(dir);
+		ERR_FAIL_COND_V_MSG(err, err, "Failed to create directory " + dir);
+	}
+
+	// each batch gets its own decompiler instance, as they hold per-script state
+	int num_jobs = _get_num_jobs(job.tokens.size());
+	job.batch_size = (job.tokens.size() + num_jobs - 1) / num_jobs;
+	if (num_jobs <= 1) {
+		_do_decompile_batch(0, &job);
+	} else {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(
+				this,
+				&ImportExporter::_do_decompile_batch,
+				&job,
+				num_jobs, -1, true, SNAME("ImportExporter::decompile_scripts"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	// remove the compiled scripts and their remaps, and record the results in the original order
+	bool has_remaps = get_settings()->has_any_remaps();
+	Ref<DirAccess> da = DirAccess::open(p_out_dir);
+	Error first_err = OK;
+	for (const ScriptDecompToken &token : job.tokens) {
+		const String &f = token.path;
+		if (token.err) {
 			failed_scripts.push_back(f);
-			// TODO: make it not fail hard on the first script that fails to decompile
-			if (encrypted) {
+			if (token.encrypted) {
 				had_encryption_error = true;
-				ERR_FAIL_V_MSG(err, "error decompiling encrypted script " + f);
-			} else {
-				ERR_FAIL_V_MSG(err, "error decompiling " + f);
-			}
-		} else {
-			String text = decomp->get_script_text();
-			String out_path = p_out_dir.path_join(dest_file.replace("res://", ""));
-			Ref<FileAccess> fa = FileAccess::open(out_path, FileAccess::WRITE);
-			if (fa.is_null()) {
-				failed_scripts.push_back(f);
-				memdelete(decomp);
-				ERR_FAIL_V_MSG(ERR_FILE_CANT_WRITE, "error failed to save " + f);
 			}
-			fa->store_string(text);
-			da->remove(f.replace("res://", ""));
-			if (has_remaps && get_settings()->has_remap(f, dest_file)) {
-				get_settings()->remove_remap(f, dest_file);
+			if (first_err == OK) {
+				first_err = token.err;
 			}
-			// TODO: make "remove_remap" do this instead
-			if (da->file_exists(f.replace(".gdc", ".gd.remap").replace("res://", ""))) {
-				da->remove(f.replace(".gdc", ".gd.remap").replace("res://", ""));
+			continue;
+		}
+		da->remove(f.replace("res://", ""));
+		if (has_remaps && get_settings()->has_remap(f, token.dest_file)) {
+			get_settings()->remove_remap(f, token.dest_file);
+		}
+		// TODO: make "remove_remap" do this instead
+		if (da->file_exists(f.replace(".gdc", ".gd.remap").replace("res://", ""))) {
+			da->remove(f.replace(".gdc", ".gd.remap").replace("res://", ""));
+		}
+		decompiled_scripts.push_back(f);
+	}
+	if (!failed_scripts.is_empty()) {
+		print_line("Failed to decompile " + itos(failed_scripts.size()) + " of " + itos(job.tokens.size()) + " scripts:");
+		for (const ScriptDecompToken &token : job.tokens) {
+			if (token.err) {
+				print_line("  " + token.path + (token.error_message.is_empty() ? "" : ": " + token.error_message));
 			}
-			print_verbose("successfully decompiled " + f);
-			decompiled_scripts.push_back(f);
 		}
 	}
-	memdelete(decomp);
+
+	err = OK;
 	// save changed config file
 	if (get_settings()->is_project_config_loaded()) { // some game pcks do not have project configs
 		err = get_settings()->save_project_config(p_out_dir);
@@ -459,7 +568,46 @@ Error ImportExporter::decompile_scripts(const String &p_out_dir) {
 	if (err) {
 		WARN_PRINT("Failed to save changed project config!");
 	}
-	return OK;
+	return first_err;
+}
+
+void ImportExporter::_do_decompile_batch(uint32_t batch, ScriptDecompJob *job) {
+	int start = batch * job->batch_size;
+	int end = MIN(start + job->batch_size, job->tokens.size());
+	if (start >= end) {
+		return;
+	}
+	GDScriptDecomp *decomp = create_decomp_for_commit(job->revision);
+	ScriptDecompToken *tokens = job->tokens.ptrw();
+	for (int i = start; i < end; i++) {
+		ScriptDecompToken &token = tokens[i];
+		print_verbose("decompiling " + token.path);
+		if (token.encrypted) {
+			token.err = decomp->decompile_byte_code_encrypted(token.path, job->key);
+		} else {
+			token.err = decomp->decompile_byte_code(token.path);
+		}
+		if (token.err) {
+			token.error_message = decomp->get_error_message();
+			if (token.encrypted) {
+				WARN_PRINT("error decompiling encrypted script " + token.path);
+			} else {
+				WARN_PRINT("error decompiling " + token.path);
+			}
+			continue;
+		}
+		String out_path = job->output_dir.path_join(token.dest_file.replace("res://", ""));
+		Ref<FileAccess> fa = FileAccess::open(out_path, FileAccess::WRITE);
+		if (fa.is_null()) {
+			token.err = ERR_FILE_CANT_WRITE;
+			token.error_message = "failed to save " + out_path;
+			WARN_PRINT("error failed to save " + token.path);
+			continue;
+		}
+		fa->store_string(decomp->get_script_text());
+		print_verbose("successfully decompiled " + token.path);
+	}
+	memdelete(decomp);
 }
 
 Error ImportExporter::recreate_plugin_config(const String &output_dir, const String &plugin_dir) {
@@ -812,8 +960,14 @@ Error ImportExporter::export_translation(const String &output_dir, Ref<ImportInf
 	f->flush();
 	f = Ref<FileAccess>();
 	if (missing_keys) {
-		translation_export_message += "WARNING: Could not recover " + itos(missing_keys) + " keys for translation.csv" + "\n";
-		translation_export_message += "Saved " + iinfo->get_source_file().get_file() + " to " + iinfo->get_export_dest() + "\n";
+		String message = "WARNING: Could not recover " + itos(missing_keys) + " keys for translation.csv" + "\n";
+		message += "Saved " + iinfo->get_source_file().get_file() + " to " + iinfo->get_export_dest() + "\n";
+		if (current_export_token) {
+			current_export_token->translation_export_message += message;
+		} else {
+			MutexLock lock(report_mutex);
+			translation_export_message += message;
+		}
 		WARN_PRINT("Could not guess all keys in translation.csv");
 	}
 	print_line("Recreated translation.csv");
@@ -863,19 +1017,18 @@ Error ImportExporter::export_texture(const String &output_dir, Ref<ImportInfo> &
 		}
 	}
 
-	Error err;
-	if (iinfo->get_importer() == "bitmap") {
-		err = _convert_bitmap(output_dir, path, iinfo->get_export_dest(), lossy);
-	} else {
-		err = _convert_tex(output_dir, path, iinfo->get_export_dest(), lossy);
-	}
+	// the image is only decoded once, even if it's also saved as a lossless copy
+	Ref<Image> img;
+	Error err = _load_texture_image(path, iinfo->get_importer() == "bitmap", img);
 	if (err == ERR_UNAVAILABLE) {
 		// Already reported in export functions above
 		return ERR_UNAVAILABLE;
 	}
 	ERR_FAIL_COND_V(err, err);
+	err = _save_texture_image(output_dir, path, iinfo->get_export_dest(), img, lossy);
+	ERR_FAIL_COND_V(err, err);
 	// If lossy, also convert it as a png
-	if (lossy) {
+	if (lossy && opt_export_lossless_copies) {
 		String dest = iinfo->get_export_dest().get_basename() + ".png";
 		if (!dest.replace("res://", "").begins_with(".assets")) {
 			String prefix = ".assets";
@@ -885,10 +1038,7 @@ Error ImportExporter::export_texture(const String &output_dir, Ref<ImportInfo> &
 			dest = prefix.path_join(dest.replace("res://", ""));
 		}
 		iinfo->set_export_lossless_copy(dest);
-		err = _convert_tex(output_dir, path, dest, false);
-		if (err == ERR_UNAVAILABLE) {
-			return ERR_UNAVAILABLE;
-		}
+		err = _save_texture_image(output_dir, path, dest, img, false);
 		ERR_FAIL_COND_V(err != OK, err);
 	}
 	if (should_rewrite_metadata) {
@@ -947,46 +1097,25 @@ Error ImportExporter::convert_res_bin_2_txt(const String &output_dir, const Stri
 	print_verbose("Converted " + p_path + " to " + p_dst);
 	return err;
 }
-Error ImportExporter::_convert_bitmap(const String &output_dir, const String &p_path, const String &p_dst, bool lossy = true) {
-	String dst_dir = output_dir.path_join(p_dst.get_base_dir().replace("res://", ""));
-	String dest_path = output_dir.path_join(p_dst.replace("res://", ""));
+Error ImportExporter::_load_texture_image(const String &p_path, bool p_bitmap, Ref<Image> &r_img) {
 	Error err;
 	TextureLoaderCompat tl;
-	Ref<Image> img = tl.load_image_from_bitmap(p_path, &err);
-	// deprecated format
-	if (err == ERR_UNAVAILABLE) {
-		// TODO: Not reporting here because we can't get the deprecated format type yet,
-		// implement functionality to pass it back
-		print_line("Did not convert deprecated Bitmap resource " + p_path);
-		return err;
-	}
-	ERR_FAIL_COND_V_MSG(err != OK, err, "Failed to load bitmap " + p_path);
-	err = ensure_dir(dst_dir);
-	ERR_FAIL_COND_V_MSG(err != OK, err, "Failed to create dirs for " + dest_path);
-	String dest_ext = dest_path.get_extension().to_lower();
-	if (dest_ext == "jpg" || dest_ext == "jpeg") {
-		err = gdreutil::save_image_as_jpeg(dest_path, img);
-	} else if (dest_ext == "webp") {
-		err = gdreutil::save_image_as_webp(dest_path, img, lossy);
-	} else if (dest_ext == "png") {
-		err = img->save_png(dest_path);
-	} else {
-		ERR_FAIL_V_MSG(ERR_FILE_BAD_PATH, "Invalid file name: " + dest_path);
+	if (p_bitmap) {
+		r_img = tl.load_image_from_bitmap(p_path, &err);
+		// deprecated format
+		if (err == ERR_UNAVAILABLE) {
+			// TODO: Not reporting here because we can't get the deprecated format type yet,
+			// implement functionality to pass it back
+			print_line("Did not convert deprecated Bitmap resource " + p_path);
+			return err;
+		}
+		ERR_FAIL_COND_V_MSG(err != OK || r_img.is_null(), err, "Failed to load bitmap " + p_path);
+		return OK;
 	}
 
-	ERR_FAIL_COND_V_MSG(err != OK, err, "Failed to save image " + dest_path + " from texture " + p_path);
-
-	print_verbose("Converted " + p_path + " to " + p_dst);
-	return OK;
-}
-
-Error ImportExporter::_convert_tex(const String &output_dir, const String &p_path, const String &p_dst, bool lossy = true) {
-	String dst_dir = output_dir.path_join(p_dst.get_base_dir().replace("res://", ""));
-	String dest_path = output_dir.path_join(p_dst.replace("res://", ""));
-	Error err;
-	TextureLoaderCompat tl;
-
-	Ref<Image> img = tl.load_image_from_tex(p_path, &err);
+	// 2d textures decode to a single image
+	Vector<Ref<Image>> images = tl.load_images_from_tex(p_path, &err);
+	r_img = images.size() > 0 ? images[0] : Ref<Image>();
 	// deprecated format
 	if (err == ERR_UNAVAILABLE) {
 		// TODO: Not reporting here because we can't get the deprecated format type yet,
@@ -994,13 +1123,11 @@ Error ImportExporter::_convert_tex(const String &output_dir, const String &p_pat
 		print_line("Did not convert deprecated Texture resource " + p_path);
 		return err;
 	}
-	ERR_FAIL_COND_V_MSG(err != OK || img.is_null(), err, "Failed to load texture " + p_path);
-	ERR_FAIL_COND_V_MSG(img->is_empty(), ERR_FILE_EOF, "Image data is empty for texture " + p_path + ", not saving");
-	err = ensure_dir(dst_dir);
-	ERR_FAIL_COND_V_MSG(err != OK, err, "Failed to create dirs for " + dest_path);
-	if (img->is_compressed()) {
-		err = img->decompress();
-		String fmt_name = Image::get_format_name(img->get_format());
+	ERR_FAIL_COND_V_MSG(err != OK || r_img.is_null(), err, "Failed to load texture " + p_path);
+	ERR_FAIL_COND_V_MSG(r_img->is_empty(), ERR_FILE_EOF, "Image data is empty for texture " + p_path + ", not saving");
+	if (r_img->is_compressed()) {
+		err = r_img->decompress();
+		String fmt_name = Image::get_format_name(r_img->get_format());
 		if (err == ERR_UNAVAILABLE) {
 			WARN_PRINT("Decompression not implemented yet for texture format " + fmt_name);
 			report_unsupported_resource("Texture", fmt_name, p_path);
@@ -1008,13 +1135,22 @@ Error ImportExporter::_convert_tex(const String &output_dir, const String &p_pat
 		}
 		ERR_FAIL_COND_V_MSG(err != OK, err, "Failed to decompress " + fmt_name + " texture " + p_path);
 	}
+	return OK;
+}
+
+// The encoders only read the image, so the same decoded image can be saved to several destinations
+Error ImportExporter::_save_texture_image(const String &output_dir, const String &p_path, const String &p_dst, const Ref<Image> &p_img, bool lossy) {
+	String dst_dir = output_dir.path_join(p_dst.get_base_dir().replace("res://", ""));
+	String dest_path = output_dir.path_join(p_dst.replace("res://", ""));
+	Error err = ensure_dir(dst_dir);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Failed to create dirs for " + dest_path);
 	String dest_ext = dest_path.get_extension().to_lower();
 	if (dest_ext == "jpg" || dest_ext == "jpeg") {
-		err = gdreutil::save_image_as_jpeg(dest_path, img);
+		err = gdreutil::save_image_as_jpeg(dest_path, p_img);
 	} else if (dest_ext == "webp") {
-		err = gdreutil::save_image_as_webp(dest_path, img, lossy);
+		err = gdreutil::save_image_as_webp(dest_path, p_img, lossy);
 	} else if (dest_ext == "png") {
-		err = img->save_png(dest_path);
+		err = p_img->save_png(dest_path);
 	} else {
 		ERR_FAIL_V_MSG(ERR_FILE_BAD_PATH, "Invalid file name: " + dest_path);
 	}
@@ -1025,6 +1161,15 @@ Error ImportExporter::_convert_tex(const String &output_dir, const String &p_pat
 	return OK;
 }
 
+Error ImportExporter::_convert_tex(const String &output_dir, const String &p_path, const String &p_dst, bool lossy = true) {
+	Ref<Image> img;
+	Error err = _load_texture_image(p_path, false, img);
+	if (err != OK) {
+		return err;
+	}
+	return _save_texture_image(output_dir, p_path, p_dst, img, lossy);
+}
+
 Error ImportExporter::convert_tex_to_png(const String &output_dir, const String &p_path, const String &p_dst) {
 	return _convert_tex(output_dir, p_path, p_dst);
 }
@@ -1047,13 +1192,23 @@ String ImportExporter::_get_path(const String &output_dir, const String &p_path)
 }
 
 void ImportExporter::report_unsupported_resource(const String &type, const String &format_name, const String &import_path, bool suppress_warn, bool suppress_print) {
+	if (current_export_token) {
+		// recorded by _finish_export()
+		current_export_token->unsupported_types.push_back(Pair<String, String>(type, format_name));
+	} else {
+		_add_unsupported_type(type, format_name);
+	}
+	if (!suppress_print)
+		print_line("Did not convert " + type + " resource " + import_path);
+}
+
+void ImportExporter::_add_unsupported_type(const String &type, const String &format_name) {
 	String type_format_str = type + "%" + format_name.to_lower();
+	MutexLock lock(report_mutex);
 	if (unsupported_types.find(type_format_str) == -1) {
 		WARN_PRINT("Conversion for Resource of type " + type + " and format " + format_name + " not implemented");
 		unsupported_types.push_back(type_format_str);
 	}
-	if (!suppress_print)
-		print_line("Did not convert " + type + " resource " + import_path);
 }
 
 Error ImportExporter::convert_sample_to_wav(const String &output_dir, const String &p_path, const String &p_dst) {
@@ -1292,9 +1447,31 @@ void ImportExporter::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("convert_sample_to_wav"), &ImportExporter::convert_sample_to_wav);
 	ClassDB::bind_method(D_METHOD("convert_oggstr_to_ogg"), &ImportExporter::convert_oggstr_to_ogg);
 	ClassDB::bind_method(D_METHOD("convert_mp3str_to_mp3"), &ImportExporter::convert_mp3str_to_mp3);
+	ClassDB::bind_method(D_METHOD("set_num_jobs", "num_jobs"), &ImportExporter::set_num_jobs);
+	ClassDB::bind_method(D_METHOD("get_num_jobs"), &ImportExporter::get_num_jobs);
+	ClassDB::bind_method(D_METHOD("set_export_lossless_copies", "enabled"), &ImportExporter::set_export_lossless_copies);
+	ClassDB::bind_method(D_METHOD("get_export_lossless_copies"), &ImportExporter::get_export_lossless_copies);
+	ClassDB::bind_method(D_METHOD("get_report"), &ImportExporter::get_report);
+	ClassDB::bind_method(D_METHOD("get_session_notes"), &ImportExporter::get_session_notes);
 	ClassDB::bind_method(D_METHOD("reset"), &ImportExporter::reset);
 }
 
+void ImportExporter::set_num_jobs(int p_num_jobs) {
+	opt_num_jobs = p_num_jobs;
+}
+
+int ImportExporter::get_num_jobs() const {
+	return opt_num_jobs;
+}
+
+void ImportExporter::set_export_lossless_copies(bool p_enabled) {
+	opt_export_lossless_copies = p_enabled;
+}
+
+bool ImportExporter::get_export_lossless_copies() const {
+	return opt_export_lossless_copies;
+}
+
 void ImportExporter::reset_log() {
 	had_encryption_error = false;
 	lossy_imports.clear();
@@ -1322,6 +1499,8 @@ void ImportExporter::reset() {
 	opt_rewrite_imd_v3 = true;
 	opt_decompile = true;
 	opt_only_decompile = false;
+	opt_export_lossless_copies = true;
+	opt_num_jobs = -1;
 	reset_log();
 }
 
@@ -7,12 +7,18 @@
 
 #include "editor/gdre_progress.h"
 
+#include "core/io/dir_access.h"
 #include "core/io/file_access.h"
 #include "core/io/resource.h"
 #include "core/io/resource_importer.h"
 #include "core/object/object.h"
 #include "core/object/ref_counted.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/mutex.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/pair.h"
 #include "core/templates/rb_map.h"
+#include "core/templates/safe_refcount.h"
 
 class ImportExporter : public RefCounted {
 	GDCLASS(ImportExporter, RefCounted)
@@ -30,6 +36,10 @@ class ImportExporter : public RefCounted {
 	bool opt_decompile = true;
 	bool opt_only_decompile = false;
 	bool opt_write_md5_files = true;
+	// also save a png copy of textures that are exported in their lossy source format
+	bool opt_export_lossless_copies = true;
+	// -1 uses every thread in the worker pool, 1 exports serially on the calling thread
+	int opt_num_jobs = -1;
 
 	bool had_encryption_error = false;
 	bool godotsteam_detected = false;
@@ -48,13 +58,57 @@ class ImportExporter : public RefCounted {
 	Vector<Ref<ImportInfo>> success;
 	Vector<Ref<ImportInfo>> not_converted;
 
+	// guards the report state that exporters write to from worker threads
+	Mutex report_mutex;
+	SafeFlag export_cancelled;
+	SafeNumeric<uint32_t> export_tasks_completed;
+
+	// Per-resource result of an export task; results are recorded serially after all tasks have finished
+	struct ExportToken {
+		Ref<ImportInfo> iinfo;
+		String output_dir;
+		Error err = OK;
+		bool skipped_lossy = false;
+		bool should_rewrite_metadata = false;
+		bool not_exported = false;
+		bool not_converted = false;
+		bool remove_autoconverted = false;
+		// report entries made while exporting; merged into the report in import order, not completion order
+		Vector<Pair<String, String>> unsupported_types;
+		String translation_export_message;
+	};
+	// the export task running on this thread, if any
+	static thread_local ExportToken *current_export_token;
+
+	struct ScriptDecompToken {
+		String path;
+		String dest_file;
+		bool encrypted = false;
+		Error err = OK;
+		String error_message;
+	};
+
+	struct ScriptDecompJob {
+		uint64_t revision = 0;
+		String output_dir;
+		Vector<uint8_t> key;
+		int batch_size = 0;
+		Vector<ScriptDecompToken> tokens;
+	};
+
+	int _get_num_jobs(int p_num_items) const;
+	void _do_export(uint32_t i, ExportToken *tokens);
+	void _finish_export(ExportToken &token, Ref<DirAccess> &dir);
+	void _do_decompile_batch(uint32_t batch, ScriptDecompJob *job);
+
 	Error export_texture(const String &output_dir, Ref<ImportInfo> &iinfo);
 	Error export_sample(const String &output_dir, Ref<ImportInfo> &iinfo);
 	Error export_fontfile(const String &output_dir, Ref<ImportInfo> &iinfo);
 	Error rewrite_import_source(const String &rel_dest_path, const String &output_dir, const Ref<ImportInfo> &iinfo);
-	Error _convert_bitmap(const String &output_dir, const String &p_path, const String &p_dst, bool lossy);
 	Error export_translation(const String &output_dir, Ref<ImportInfo> &iinfo);
 
+	Error _load_texture_image(const String &p_path, bool p_bitmap, Ref<Image> &r_img);
+	Error _save_texture_image(const String &output_dir, const String &p_path, const String &p_dst, const Ref<Image> &p_img, bool lossy);
 	Error _convert_tex(const String &output_dir, const String &p_path, const String &p_dst, bool lossy);
 	Error _convert_tex_to_jpg(const String &output_dir, const String &p_path, const String &p_dst);
 
@@ -62,6 +116,7 @@ class ImportExporter : public RefCounted {
 	static Vector<String> get_v2_wildcards();
 	String _get_path(const String &output_dir, const String &p_path);
 	void report_unsupported_resource(const String &type, const String &format_name, const String &import_path, bool suppress_warn = false, bool suppress_print = false);
+	void _add_unsupported_type(const String &type, const String &format_name);
 
 protected:
 	static void _bind_methods();
@@ -82,6 +137,10 @@ public:
 
 	Error _export_imports(const String &output_dir, const Vector<String> &files_to_export, EditorProgressGDDC *pr, String &error_string);
 	Error export_imports(const String &output_dir = "", const Vector<String> &files_to_export = {});
+	void set_num_jobs(int p_num_jobs);
+	int get_num_jobs() const;
+	void set_export_lossless_copies(bool p_enabled);
+	bool get_export_lossless_copies() const;
 	String get_totals();
 	void print_report();
 	String get_editor_message();
@@ -2,6 +2,8 @@
 #include "compat/resource_loader_compat.h"
 #include "gdre_settings.h"
 
+#include "core/io/file_access.h"
+
 String ImportInfo::to_string() {
 	return as_text(false);
 }
@@ -385,10 +387,21 @@ void ImportInfoModern::set_params(Dictionary params) {
 	dirty = true;
 }
 
+// ConfigFile::load() parses through FileAccess one character at a time, which is slow for packed files;
+// read the whole file up front and parse it from memory instead
+static Error _load_config_file(const Ref<ConfigFile> &cf, const String &p_path) {
+	Error err;
+	String text = FileAccess::get_file_as_string(p_path, &err);
+	if (err) {
+		return err;
+	}
+	return cf->parse(text);
+}
+
 Error ImportInfoModern::_load(const String &p_path) {
 	cf.instantiate();
 	String path = GDRESettings::get_singleton()->get_res_path(p_path);
-	Error err = cf->load(path);
+	Error err = _load_config_file(cf, path);
 	if (err) {
 		cf = Ref<ConfigFile>();
 	}
@@ -466,7 +479,7 @@ Error ImportInfoRemap::_load(const String &p_path) {
 	cf.instantiate();
 	source_file = p_path.get_basename(); // res://scene.tscn.remap -> res://scene.tscn
 	String path = GDRESettings::get_singleton()->get_res_path(p_path);
-	Error err = cf->load(path);
+	Error err = _load_config_file(cf, path);
 	if (err) {
 		cf = Ref<ConfigFile>();
 	}
@@ -0,0 +1,620 @@
+#include "pck_creator.h"
+#include "gdre_settings.h"
+
+#include "core/crypto/crypto_core.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/io/file_access_encrypted.h"
+
+#define PCK_PADDING 16
+
+static int _get_pad(int p_alignment, int64_t p_n) {
+	int rest = p_n % p_alignment;
+	int pad = 0;
+	if (rest > 0) {
+		pad = p_alignment - rest;
+	};
+
+	return pad;
+}
+
+void PckCreator::set_pack_version(int p_version) {
+	pack_version = p_version;
+}
+
+int PckCreator::get_pack_version() const {
+	return pack_version;
+}
+
+void PckCreator::set_ver_major(int p_major) {
+	ver_major = p_major;
+}
+
+int PckCreator::get_ver_major() const {
+	return ver_major;
+}
+
+void PckCreator::set_ver_minor(int p_minor) {
+	ver_minor = p_minor;
+}
+
+int PckCreator::get_ver_minor() const {
+	return ver_minor;
+}
+
+void PckCreator::set_ver_rev(int p_rev) {
+	ver_rev = p_rev;
+}
+
+int PckCreator::get_ver_rev() const {
+	return ver_rev;
+}
+
+void PckCreator::set_encrypt_directory(bool p_encrypt) {
+	encrypt_directory = p_encrypt;
+}
+
+bool PckCreator::get_encrypt_directory() const {
+	return encrypt_directory;
+}
+
+void PckCreator::set_encrypt_include_filters(const Vector<String> &p_filters) {
+	encrypt_include_filters = p_filters;
+}
+
+Vector<String> PckCreator::get_encrypt_include_filters() const {
+	return encrypt_include_filters;
+}
+
+void PckCreator::set_encrypt_exclude_filters(const Vector<String> &p_filters) {
+	encrypt_exclude_filters = p_filters;
+}
+
+Vector<String> PckCreator::get_encrypt_exclude_filters() const {
+	return encrypt_exclude_filters;
+}
+
+void PckCreator::set_encryption_key(const Vector<uint8_t> &p_key) {
+	encryption_key = p_key;
+}
+
+Vector<uint8_t> PckCreator::get_encryption_key() const {
+	return encryption_key;
+}
+
+void PckCreator::set_watermark(const String &p_watermark) {
+	watermark = p_watermark;
+}
+
+String PckCreator::get_watermark() const {
+	return watermark;
+}
+
+void PckCreator::set_embed_source(const String &p_exe_path) {
+	embed_source = p_exe_path;
+}
+
+String PckCreator::get_embed_source() const {
+	return embed_source;
+}
+
+void PckCreator::set_buffer_size(int64_t p_size) {
+	opt_buffer_size = p_size;
+}
+
+int64_t PckCreator::get_buffer_size() const {
+	return opt_buffer_size;
+}
+
+int PckCreator::get_file_count() const {
+	return files.size();
+}
+
+bool PckCreator::_is_encrypted(const String &p_rel_path) const {
+	String res_path = "res://" + p_rel_path;
+	bool encrypted = false;
+	for (int i = 0; i < encrypt_include_filters.size(); ++i) {
+		if (encrypt_include_filters[i].is_empty()) {
+			continue;
+		}
+		if (p_rel_path.matchn(encrypt_include_filters[i]) || res_path.matchn(encrypt_include_filters[i])) {
+			encrypted = true;
+			break;
+		}
+	}
+	if (!encrypted) {
+		return false;
+	}
+	for (int i = 0; i < encrypt_exclude_filters.size(); ++i) {
+		if (encrypt_exclude_filters[i].is_empty()) {
+			continue;
+		}
+		if (p_rel_path.matchn(encrypt_exclude_filters[i]) || res_path.matchn(encrypt_exclude_filters[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+Error PckCreator::_scan_folder_recursive(const String &p_rel, EditorProgressGDDC *pr) {
+	Ref<DirAccess> da = DirAccess::open(source_dir.path_join(p_rel));
+	ERR_FAIL_COND_V_MSG(da.is_null(), ERR_FILE_CANT_OPEN, "Error opening folder: " + source_dir.path_join(p_rel));
+	da->list_dir_begin();
+	String f = da->get_next();
+	while (!f.is_empty()) {
+		if (f == "." || f == "..") {
+			f = da->get_next();
+			continue;
+		}
+		String rel_path = p_rel.path_join(f);
+		if (pr && pr->step(rel_path, 0, true)) {
+			da->list_dir_end();
+			return ERR_PRINTER_ON_FIRE;
+		}
+		if (da->current_is_dir()) {
+			Error err = _scan_folder_recursive(rel_path, pr);
+			if (err) {
+				da->list_dir_end();
+				return err;
+			}
+		} else {
+			// sizes, offsets and hashes are filled in while the file is copied into the pack
+			FileToken token;
+			token.rel_path = rel_path;
+			token.encrypted = _is_encrypted(rel_path);
+			files.push_back(token);
+		}
+		f = da->get_next();
+	}
+	da->list_dir_end();
+	return OK;
+}
+
+Error PckCreator::_scan_folder(const String &p_dir, EditorProgressGDDC *pr) {
+	files.clear();
+	source_dir = p_dir;
+	Error err = _scan_folder_recursive(String(), pr);
+	if (err) {
+		files.clear();
+		return err;
+	}
+	ERR_FAIL_COND_V_MSG(files.is_empty(), ERR_FILE_NOT_FOUND, "Error opening folder (or empty folder): " + p_dir);
+	// directory listing order depends on the filesystem; sort so the same folder always produces the same pack
+	files.sort();
+	return OK;
+}
+
+// The directory entries are all fixed-size, so the directory can be stored once with placeholder
+// values before the file data and rewritten in place once the offsets and hashes are known.
+Error PckCreator::_store_directory(Ref<FileAccess> f) {
+	Ref<FileAccessEncrypted> fae;
+	Ref<FileAccess> fhead = f;
+	if (pack_version == 2 && encrypt_directory) {
+		fae.instantiate();
+		ERR_FAIL_COND_V(fae.is_null(), ERR_CANT_CREATE);
+
+		Error err = fae->open_and_parse(f, encryption_key, FileAccessEncrypted::MODE_WRITE_AES256, false);
+		ERR_FAIL_COND_V(err != OK, err);
+
+		fhead = fae;
+	}
+
+	for (int i = 0; i < files.size(); i++) {
+		CharString name = ("res://" + files[i].rel_path).utf8();
+		uint32_t string_len = name.length();
+		uint32_t pad = _get_pad(4, string_len);
+
+		fhead->store_32(string_len + pad);
+		fhead->store_buffer((const uint8_t *)name.get_data(), string_len);
+		for (uint32_t j = 0; j < pad; j++) {
+			fhead->store_8(0);
+		}
+
+		fhead->store_64(files[i].offset);
+		fhead->store_64(files[i].size); // pay attention here, this is where file is
+		fhead->store_buffer(files[i].md5, 16); //also save md5 for file
+		if (pack_version == 2) {
+			fhead->store_32(files[i].encrypted ? 1 : 0);
+		}
+	}
+
+	if (fae.is_valid()) {
+		fae.unref();
+	}
+	return OK;
+}
+
+Error PckCreator::_copy_embed_source(Ref<FileAccess> f, int64_t &r_embedded_start) {
+	Ref<FileAccess> fs = FileAccess::open(embed_source, FileAccess::READ);
+	ERR_FAIL_COND_V_MSG(fs.is_null(), ERR_FILE_CANT_OPEN, "Error opening source executable file: " + embed_source);
+
+	fs->seek_end();
+	fs->seek(fs->get_position() - 4);
+	int32_t magic = fs->get_32();
+	if (magic == 0x43504447) {
+		// exe already have embedded pck
+		fs->seek(fs->get_position() - 12);
+		uint64_t ds = fs->get_64();
+		fs->seek(fs->get_position() - ds - 8);
+	} else {
+		fs->seek_end();
+	}
+	uint64_t exe_end = fs->get_position();
+	fs->seek(0);
+	// copy executable data
+	Vector<uint8_t> buf;
+	buf.resize(MIN((uint64_t)opt_buffer_size, MAX(exe_end, (uint64_t)1)));
+	uint8_t *buf_ptr = buf.ptrw();
+	uint64_t rq_size = exe_end;
+	while (rq_size > 0) {
+		uint64_t got = fs->get_buffer(buf_ptr, MIN((uint64_t)buf.size(), rq_size));
+		ERR_FAIL_COND_V_MSG(got == 0, ERR_FILE_CANT_READ, "Error reading source executable file: " + embed_source);
+		f->store_buffer(buf_ptr, got);
+		rq_size -= got;
+	}
+
+	r_embedded_start = f->get_position();
+
+	// ensure embedded PCK starts at a 64-bit multiple
+	int pad = _get_pad(8, f->get_position());
+	for (int i = 0; i < pad; i++) {
+		f->store_8(0);
+	}
+	return OK;
+}
+
+Error PckCreator::_fix_embedded_exe(Ref<FileAccess> f, int64_t p_embedded_start, int64_t p_embedded_size) {
+	f->seek(0);
+	int16_t exe1_magic = f->get_16();
+	int16_t exe2_magic = f->get_16();
+	if (exe1_magic == 0x5A4D) {
+		//windows (pe) - copy from "platform/windows/export/export.cpp"
+		f->seek(0x3c);
+		uint32_t pe_pos = f->get_32();
+
+		f->seek(pe_pos);
+		uint32_t magic = f->get_32();
+		ERR_FAIL_COND_V_MSG(magic != 0x00004550, ERR_FILE_CORRUPT, "Invalid PE magic");
+
+		// Process header
+		int num_sections;
+		{
+			int64_t header_pos = f->get_position();
+
+			f->seek(header_pos + 2);
+			num_sections = f->get_16();
+			f->seek(header_pos + 16);
+			uint16_t opt_header_size = f->get_16();
+
+			// Skip rest of header + optional header to go to the section headers
+			f->seek(f->get_position() + 2 + opt_header_size);
+		}
+
+		// Search for the "pck" section
+		int64_t section_table_pos = f->get_position();
+
+		for (int i = 0; i < num_sections; ++i) {
+			int64_t section_header_pos = section_table_pos + i * 40;
+			f->seek(section_header_pos);
+
+			uint8_t section_name[9];
+			f->get_buffer(section_name, 8);
+			section_name[8] = '\0';
+
+			if (strcmp((char *)section_name, "pck") == 0) {
+				// "pck" section found, let's patch!
+
+				// Set virtual size to a little to avoid it taking memory (zero would give issues)
+				f->seek(section_header_pos + 8);
+				f->store_32(8);
+
+				f->seek(section_header_pos + 16);
+				f->store_32(p_embedded_size);
+				f->seek(section_header_pos + 20);
+				f->store_32(p_embedded_start);
+
+				break;
+			}
+		}
+	} else if ((exe1_magic == 0x457F) && (exe2_magic == 0x464C)) {
+		// linux (elf) - copy from "platform/x11/export/export.cpp"
+		// Read program architecture bits from class field
+		int bits = f->get_8() * 32;
+
+		ERR_FAIL_COND_V_MSG(bits == 32 && p_embedded_size >= 0x100000000, ERR_INVALID_DATA, "32-bit executables cannot have embedded data >= 4 GiB");
+
+		// Get info about the section header table
+		int64_t section_table_pos;
+		int64_t section_header_size;
+		if (bits == 32) {
+			section_header_size = 40;
+			f->seek(0x20);
+			section_table_pos = f->get_32();
+			f->seek(0x30);
+		} else { // 64
+			section_header_size = 64;
+			f->seek(0x28);
+			section_table_pos = f->get_64();
+			f->seek(0x3c);
+		}
+		int num_sections = f->get_16();
+		int string_section_idx = f->get_16();
+
+		// Load the strings table
+		uint8_t *strings;
+		{
+			// Jump to the strings section header
+			f->seek(section_table_pos + string_section_idx * section_header_size);
+
+			// Read strings data size and offset
+			int64_t string_data_pos;
+			int64_t string_data_size;
+			if (bits == 32) {
+				f->seek(f->get_position() + 0x10);
+				string_data_pos = f->get_32();
+				string_data_size = f->get_32();
+			} else { // 64
+				f->seek(f->get_position() + 0x18);
+				string_data_pos = f->get_64();
+				string_data_size = f->get_64();
+			}
+
+			// Read strings data
+			f->seek(string_data_pos);
+			strings = (uint8_t *)memalloc(string_data_size);
+			ERR_FAIL_COND_V_MSG(!strings, ERR_OUT_OF_MEMORY, "Out of memory");
+			f->get_buffer(strings, string_data_size);
+		}
+
+		// Search for the "pck" section
+		for (int i = 0; i < num_sections; ++i) {
+			int64_t section_header_pos = section_table_pos + i * section_header_size;
+			f->seek(section_header_pos);
+
+			uint32_t name_offset = f->get_32();
+			if (strcmp((char *)strings + name_offset, "pck") == 0) {
+				// "pck" section found, let's patch!
+
+				if (bits == 32) {
+					f->seek(section_header_pos + 0x10);
+					f->store_32(p_embedded_start);
+					f->store_32(p_embedded_size);
+				} else { // 64
+					f->seek(section_header_pos + 0x18);
+					f->store_64(p_embedded_start);
+					f->store_64(p_embedded_size);
+				}
+
+				break;
+			}
+		}
+		memfree(strings);
+	}
+	return OK;
+}
+
+// Each file is read exactly once: its MD5 is computed while it is being copied into the pack,
+// and the directory is patched afterwards.
+Error PckCreator::_write_pck(const String &p_pck_path, EditorProgressGDDC *pr, String &error_string) {
+	ERR_FAIL_COND_V_MSG(files.is_empty(), ERR_FILE_NOT_FOUND, "No files to pack, call _scan_folder() first.");
+	ERR_FAIL_COND_V_MSG(pack_version != 1 && pack_version != 2, ERR_INVALID_PARAMETER, "Invalid pack version: " + itos(pack_version));
+
+	bool has_encrypted = pack_version == 2 && encrypt_directory;
+	for (int i = 0; i < files.size(); i++) {
+		// only version 2 packs can flag encrypted files
+		if (pack_version != 2) {
+			files.write[i].encrypted = false;
+		}
+		has_encrypted = has_encrypted || files[i].encrypted;
+	}
+	if (has_encrypted && encryption_key.size() != 32) {
+		// fall back to the currently set key
+		encryption_key = GDRESettings::get_singleton()->get_encryption_key();
+		ERR_FAIL_COND_V_MSG(encryption_key.size() != 32, ERR_UNCONFIGURED, "Encryption key is not set!");
+	}
+
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_pck_path, FileAccess::WRITE_READ, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), ERR_FILE_CANT_WRITE, "Error opening PCK file: " + p_pck_path);
+
+	int64_t embedded_start = 0;
+	int64_t embedded_size = 0;
+	if (!embed_source.is_empty()) {
+		if (pr) {
+			pr->step("Exec...", 0, true);
+		}
+		// append to exe
+		err = _copy_embed_source(f, embedded_start);
+		ERR_FAIL_COND_V(err, err);
+	}
+	int64_t pck_start_pos = f->get_position();
+
+	f->store_32(0x43504447); //GDPK
+	f->store_32(pack_version);
+	f->store_32(ver_major);
+	f->store_32(ver_minor);
+	f->store_32(ver_rev);
+
+	int64_t file_base_ofs = 0;
+	if (pack_version == 2) {
+		uint32_t pack_flags = 0;
+		if (encrypt_directory) {
+			pack_flags |= (1 << 0);
+		}
+		f->store_32(pack_flags); // flags
+		file_base_ofs = f->get_position();
+		f->store_64(0); // files base
+	}
+
+	for (int i = 0; i < 16; i++) {
+		//reserved
+		f->store_32(0);
+	}
+
+	if (pr) {
+		pr->step("Header...", 0, true);
+	}
+
+	f->store_32(files.size()); //amount of files
+
+	if (pr) {
+		pr->step("Directory...", 0, true);
+	}
+
+	// placeholder, rewritten below
+	int64_t dir_start = f->get_position();
+	err = _store_directory(f);
+	ERR_FAIL_COND_V(err, err);
+
+	// zero padding, so the same input always produces the same pack
+	int header_padding = _get_pad(PCK_PADDING, f->get_position());
+	for (int j = 0; j < header_padding; j++) {
+		f->store_8(0);
+	}
+
+	int64_t file_base = f->get_position();
+	if (pack_version == 2) {
+		f->seek(file_base_ofs);
+		f->store_64(file_base); // update files base
+		f->seek(file_base);
+	}
+
+	Vector<uint8_t> buf;
+	buf.resize(opt_buffer_size);
+	uint8_t *buf_ptr = buf.ptrw();
+
+	for (int i = 0; i < files.size(); i++) {
+		FileToken &token = files.write[i];
+		print_verbose("saving " + token.rel_path);
+		if (pr && pr->step(token.rel_path, i + 2, true)) {
+			return ERR_PRINTER_ON_FIRE;
+		}
+
+		// v1 offsets are absolute, v2 offsets are relative to the files base
+		int64_t file_start = f->get_position();
+		token.offset = pack_version == 2 ? file_start - file_base : file_start;
+		token.size = 0;
+
+		Ref<FileAccessEncrypted> fae;
+		Ref<FileAccess> ftmp = f;
+		if (token.encrypted) {
+			fae.instantiate();
+			ERR_FAIL_COND_V(fae.is_null(), ERR_CANT_CREATE);
+
+			err = fae->open_and_parse(f, encryption_key, FileAccessEncrypted::MODE_WRITE_AES256, false);
+			ERR_FAIL_COND_V(err != OK, err);
+			ftmp = fae;
+		}
+
+		CryptoCore::MD5Context ctx;
+		ctx.start();
+		Ref<FileAccess> fa = FileAccess::open(source_dir.path_join(token.rel_path), FileAccess::READ);
+		if (fa.is_valid()) {
+			uint64_t rq_size = fa->get_length();
+			while (rq_size > 0) {
+				uint64_t got = fa->get_buffer(buf_ptr, MIN((uint64_t)opt_buffer_size, rq_size));
+				if (got == 0) {
+					break;
+				}
+				ctx.update(buf_ptr, got);
+				ftmp->store_buffer(buf_ptr, got);
+				token.size += got;
+				rq_size -= got;
+			}
+			if (rq_size > 0) {
+				error_string += token.rel_path + " (read error)\n";
+			}
+		} else {
+			error_string += token.rel_path + " (FileAccess error)\n";
+		}
+		ctx.finish(token.md5);
+
+		if (fae.is_valid()) {
+			fae.unref();
+		}
+	}
+
+	int64_t data_end = f->get_position();
+	f->seek(dir_start);
+	err = _store_directory(f);
+	ERR_FAIL_COND_V(err, err);
+	f->seek(data_end);
+
+	if (!watermark.is_empty()) {
+		f->store_32(0);
+		f->store_32(0);
+		f->store_string(watermark);
+		f->store_32(0);
+		f->store_32(0);
+	}
+
+	f->store_32(0x43504447); //GDPK
+
+	if (!embed_source.is_empty()) {
+		// ensure embedded data ends at a 64-bit multiple
+		int64_t embed_end = f->get_position() - embedded_start + 12;
+		int pad = _get_pad(8, embed_end);
+		for (int i = 0; i < pad; i++) {
+			f->store_8(0);
+		}
+
+		int64_t pck_size = f->get_position() - pck_start_pos;
+		f->store_64(pck_size);
+		f->store_32(0x43504447); //GDPC
+
+		embedded_size = f->get_position() - embedded_start;
+
+		// fixup headers
+		if (pr) {
+			pr->step("Exec header fix...", files.size() + 2, true);
+		}
+		err = _fix_embedded_exe(f, embedded_start, embedded_size);
+		if (err) {
+			error_string += "Failed to patch the executable headers\n";
+			return err;
+		}
+	}
+	f->flush();
+	if (f->get_error() != OK && f->get_error() != ERR_FILE_EOF) {
+		return ERR_FILE_CANT_WRITE;
+	}
+	return error_string.is_empty() ? OK : ERR_BUG;
+}
+
+Error PckCreator::pck_create(const String &p_pck_path, const String &p_dir) {
+	Error err = _scan_folder(p_dir, nullptr);
+	ERR_FAIL_COND_V(err, err);
+	String error_string;
+	err = _write_pck(p_pck_path, nullptr, error_string);
+	if (!error_string.is_empty()) {
+		print_error("At least one error was detected while creating the pack:\n" + error_string);
+	}
+	return err;
+}
+
+void PckCreator::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_pack_version", "version"), &PckCreator::set_pack_version);
+	ClassDB::bind_method(D_METHOD("get_pack_version"), &PckCreator::get_pack_version);
+	ClassDB::bind_method(D_METHOD("set_ver_major", "major"), &PckCreator::set_ver_major);
+	ClassDB::bind_method(D_METHOD("get_ver_major"), &PckCreator::get_ver_major);
+	ClassDB::bind_method(D_METHOD("set_ver_minor", "minor"), &PckCreator::set_ver_minor);
+	ClassDB::bind_method(D_METHOD("get_ver_minor"), &PckCreator::get_ver_minor);
+	ClassDB::bind_method(D_METHOD("set_ver_rev", "rev"), &PckCreator::set_ver_rev);
+	ClassDB::bind_method(D_METHOD("get_ver_rev"), &PckCreator::get_ver_rev);
+	ClassDB::bind_method(D_METHOD("set_encrypt_directory", "encrypt"), &PckCreator::set_encrypt_directory);
+	ClassDB::bind_method(D_METHOD("get_encrypt_directory"), &PckCreator::get_encrypt_directory);
+	ClassDB::bind_method(D_METHOD("set_encrypt_include_filters", "filters"), &PckCreator::set_encrypt_include_filters);
+	ClassDB::bind_method(D_METHOD("get_encrypt_include_filters"), &PckCreator::get_encrypt_include_filters);
+	ClassDB::bind_method(D_METHOD("set_encrypt_exclude_filters", "filters"), &PckCreator::set_encrypt_exclude_filters);
+	ClassDB::bind_method(D_METHOD("get_encrypt_exclude_filters"), &PckCreator::get_encrypt_exclude_filters);
+	ClassDB::bind_method(D_METHOD("set_encryption_key", "key"), &PckCreator::set_encryption_key);
+	ClassDB::bind_method(D_METHOD("get_encryption_key"), &PckCreator::get_encryption_key);
+	ClassDB::bind_method(D_METHOD("set_watermark", "watermark"), &PckCreator::set_watermark);
+	ClassDB::bind_method(D_METHOD("get_watermark"), &PckCreator::get_watermark);
+	ClassDB::bind_method(D_METHOD("set_embed_source", "exe_path"), &PckCreator::set_embed_source);
+	ClassDB::bind_method(D_METHOD("get_embed_source"), &PckCreator::get_embed_source);
+	ClassDB::bind_method(D_METHOD("set_buffer_size", "size"), &PckCreator::set_buffer_size);
+	ClassDB::bind_method(D_METHOD("get_buffer_size"), &PckCreator::get_buffer_size);
+	ClassDB::bind_method(D_METHOD("get_file_count"), &PckCreator::get_file_count);
+	ClassDB::bind_method(D_METHOD("pck_create", "pck_path", "dir"), &PckCreator::pck_create);
+}
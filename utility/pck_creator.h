@@ -0,0 +1,81 @@
+#ifndef PCK_CREATOR_H
+#define PCK_CREATOR_H
+
+#include "core/io/file_access.h"
+#include "core/object/object.h"
+#include "core/object/ref_counted.h"
+#include "core/templates/vector.h"
+
+#include "editor/gdre_progress.h"
+
+class PckCreator : public RefCounted {
+	GDCLASS(PckCreator, RefCounted)
+	int pack_version = 1;
+	int ver_major = 0;
+	int ver_minor = 0;
+	int ver_rev = 0;
+	bool encrypt_directory = false;
+	Vector<String> encrypt_include_filters;
+	Vector<String> encrypt_exclude_filters;
+	Vector<uint8_t> encryption_key;
+	String watermark;
+	String embed_source;
+	int64_t opt_buffer_size = 1024 * 1024;
+
+	struct FileToken {
+		String rel_path;
+		uint64_t offset = 0;
+		uint64_t size = 0;
+		uint8_t md5[16] = {};
+		bool encrypted = false;
+
+		bool operator<(const FileToken &p_other) const {
+			return rel_path < p_other.rel_path;
+		}
+	};
+	String source_dir;
+	Vector<FileToken> files;
+
+	bool _is_encrypted(const String &p_rel_path) const;
+	Error _scan_folder_recursive(const String &p_rel, EditorProgressGDDC *pr);
+	Error _store_directory(Ref<FileAccess> f);
+	Error _copy_embed_source(Ref<FileAccess> f, int64_t &r_embedded_start);
+	Error _fix_embedded_exe(Ref<FileAccess> f, int64_t p_embedded_start, int64_t p_embedded_size);
+
+	// the editor drives these directly so it can show progress
+	friend class GodotREEditor;
+	Error _scan_folder(const String &p_dir, EditorProgressGDDC *pr);
+	Error _write_pck(const String &p_pck_path, EditorProgressGDDC *pr, String &error_string);
+
+protected:
+	static void _bind_methods();
+
+public:
+	void set_pack_version(int p_version);
+	int get_pack_version() const;
+	void set_ver_major(int p_major);
+	int get_ver_major() const;
+	void set_ver_minor(int p_minor);
+	int get_ver_minor() const;
+	void set_ver_rev(int p_rev);
+	int get_ver_rev() const;
+	void set_encrypt_directory(bool p_encrypt);
+	bool get_encrypt_directory() const;
+	void set_encrypt_include_filters(const Vector<String> &p_filters);
+	Vector<String> get_encrypt_include_filters() const;
+	void set_encrypt_exclude_filters(const Vector<String> &p_filters);
+	Vector<String> get_encrypt_exclude_filters() const;
+	void set_encryption_key(const Vector<uint8_t> &p_key);
+	Vector<uint8_t> get_encryption_key() const;
+	void set_watermark(const String &p_watermark);
+	String get_watermark() const;
+	void set_embed_source(const String &p_exe_path);
+	String get_embed_source() const;
+	void set_buffer_size(int64_t p_size);
+	int64_t get_buffer_size() const;
+
+	int get_file_count() const;
+	Error pck_create(const String &p_pck_path, const String &p_dir);
+};
+
+#endif // PCK_CREATOR_H
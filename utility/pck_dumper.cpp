@@ -6,27 +6,94 @@
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
 #include "core/io/file_access_encrypted.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
+#include "core/templates/hash_set.h"
 #include "core/variant/variant_parser.h"
 #include "core/version_generated.gen.h"
 #include "modules/regex/regex.h"
 
 const static Vector<uint8_t> empty_md5 = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
+// size of the buffer each MD5 check reads through
+static constexpr int64_t MD5_CHECK_BUFFER_SIZE = 256 * 1024;
+
 bool PckDumper::_pck_file_check_md5(Ref<PackedFileInfo> &file) {
 	// Loading an encrypted file automatically checks the md5
 	if (file->is_encrypted()) {
 		return true;
 	}
-	auto hash = FileAccess::get_md5(file->get_path());
-	auto p_md5 = String::md5(file->get_md5().ptr());
-	return hash == p_md5;
+	// each check opens its own handle into the pack, so this can run on several threads at once
+	Ref<FileAccess> f = FileAccess::open(file->get_path(), FileAccess::READ);
+	if (f.is_null()) {
+		return false;
+	}
+	CryptoCore::MD5Context ctx;
+	ctx.start();
+	Vector<uint8_t> buf;
+	buf.resize(MD5_CHECK_BUFFER_SIZE);
+	int64_t rq_size = file->get_size();
+	while (rq_size > 0) {
+		uint64_t got = f->get_buffer(buf.ptrw(), MIN(MD5_CHECK_BUFFER_SIZE, rq_size));
+		if (got == 0) {
+			break;
+		}
+		ctx.update(buf.ptr(), got);
+		rq_size -= got;
+	}
+	unsigned char hash[16];
+	ctx.finish(hash);
+	return rq_size <= 0 && memcmp(hash, file->pf.md5, 16) == 0;
+}
+
+void PckDumper::_do_md5_check(uint32_t i, MD5CheckToken *tokens) {
+	if (!tasks_cancelled.is_set()) {
+		tokens[i].passed = _pck_file_check_md5(tokens[i].file);
+	}
+	tasks_completed.increment();
+}
+
+int PckDumper::_get_num_jobs(int p_num_items) const {
+	int num_jobs = opt_num_jobs;
+	if (num_jobs <= 0 || num_jobs > WorkerThreadPool::get_singleton()->get_thread_count()) {
+		num_jobs = WorkerThreadPool::get_singleton()->get_thread_count();
+	}
+	return CLAMP(num_jobs, 1, MAX(p_num_items, 1));
+}
+
+void PckDumper::set_num_jobs(int p_num_jobs) {
+	opt_num_jobs = p_num_jobs;
+}
+
+int PckDumper::get_num_jobs() const {
+	return opt_num_jobs;
+}
+
+void PckDumper::set_check_md5_on_extract(bool p_check) {
+	should_check_md5 = p_check;
+}
+
+bool PckDumper::get_check_md5_on_extract() const {
+	return should_check_md5;
+}
+
+void PckDumper::set_buffer_size(int64_t p_size) {
+	opt_buffer_size = p_size;
+}
+
+int64_t PckDumper::get_buffer_size() const {
+	return opt_buffer_size;
 }
 
 Error PckDumper::check_md5_all_files() {
-	Vector<String> f;
+	last_broken_files.clear();
 	int ch = 0;
-	return _check_md5_all_files(f, ch, nullptr);
+	return _check_md5_all_files(last_broken_files, ch, nullptr);
+}
+
+// files that failed the last check_md5_all_files(), in pack order
+Vector<String> PckDumper::get_broken_files() const {
+	return last_broken_files;
 }
 
 Error PckDumper::_check_md5_all_files(Vector<String> &broken_files, int &checked_files, EditorProgressGDDC *pr) {
@@ -40,27 +107,65 @@ Error PckDumper::_check_md5_all_files(Vector<String> &broken_files, int &checked
 	Error err = OK;
 	auto files = GDRESettings::get_singleton()->get_file_info_list();
 	int skipped_files = 0;
+	Vector<MD5CheckToken> tokens;
 	for (int i = 0; i < files.size(); i++) {
-		if (pr) {
-			if (OS::get_singleton()->get_ticks_usec() - last_progress_upd > 20000) {
-				last_progress_upd = OS::get_singleton()->get_ticks_usec();
-				bool cancel = pr->step(files[i]->path, i, true);
-				if (cancel) {
-					return ERR_PRINTER_ON_FIRE;
-				}
-			}
-		}
 		if (files[i]->get_md5() == empty_md5) {
 			print_verbose("Skipping MD5 check for " + files[i]->path + " (no MD5 hash found)");
 			skipped_files++;
 			continue;
 		}
-		files.write[i]->set_md5_match(_pck_file_check_md5(files.write[i]));
-		if (files[i]->md5_passed) {
-			print_verbose("Verified " + files[i]->path);
+		MD5CheckToken token;
+		token.file = files[i];
+		tokens.push_back(token);
+	}
+
+	tasks_cancelled.clear();
+	tasks_completed.set(0);
+	int num_jobs = _get_num_jobs(tokens.size());
+	if (num_jobs <= 1) {
+		for (int i = 0; i < tokens.size(); i++) {
+			if (pr) {
+				if (OS::get_singleton()->get_ticks_usec() - last_progress_upd > 20000) {
+					last_progress_upd = OS::get_singleton()->get_ticks_usec();
+					bool cancel = pr->step(tokens[i].file->path, i, true);
+					if (cancel) {
+						return ERR_PRINTER_ON_FIRE;
+					}
+				}
+			}
+			_do_md5_check(i, tokens.ptrw());
+		}
+	} else if (tokens.size() > 0) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(
+				this,
+				&PckDumper::_do_md5_check,
+				tokens.ptrw(),
+				tokens.size(), num_jobs, true, SNAME("PckDumper::check_md5_all_files"));
+		while (!WorkerThreadPool::get_singleton()->is_group_task_completed(group_task)) {
+			OS::get_singleton()->delay_usec(10000);
+			if (pr && !tasks_cancelled.is_set()) {
+				int completed = MIN((int)tasks_completed.get(), tokens.size() - 1);
+				if (pr->step(tokens[completed].file->path, completed, true)) {
+					// checks that have not yet started will bail out immediately
+					tasks_cancelled.set();
+				}
+			}
+		}
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		if (tasks_cancelled.is_set()) {
+			return ERR_PRINTER_ON_FIRE;
+		}
+	}
+
+	// report in pack order so the results don't depend on the job count
+	for (int i = 0; i < tokens.size(); i++) {
+		Ref<PackedFileInfo> &file = tokens.write[i].file;
+		file->set_md5_match(tokens[i].passed);
+		if (tokens[i].passed) {
+			print_verbose("Verified " + file->path);
 		} else {
-			print_error("Checksum failed for " + files[i]->path);
-			broken_files.push_back(files[i]->path);
+			print_error("Checksum failed for " + file->path);
+			broken_files.push_back(file->path);
 			err = ERR_BUG;
 		}
 		checked_files++;
@@ -85,6 +190,68 @@ Error PckDumper::pck_dump_to_dir(const String &dir, const Vector<String> &files_
 	return _pck_dump_to_dir(dir, files_to_extract, nullptr, t);
 }
 
+// Copies a single file out of the pack; called from the worker thread pool, so results are only stored in the token
+void PckDumper::_do_extract(uint32_t i, ExtractToken *tokens) {
+	ExtractToken &token = tokens[i];
+	if (tasks_cancelled.is_set()) {
+		tasks_completed.increment();
+		return;
+	}
+	Ref<PackedFileInfo> file = token.file;
+	Error err;
+	Ref<FileAccess> pck_f = FileAccess::open(file->get_path(), FileAccess::READ, &err);
+	if (pck_f.is_null()) {
+		token.error = file->get_path() + " (FileAccess error)\n";
+		tasks_completed.increment();
+		return;
+	}
+	Ref<FileAccess> fa = FileAccess::open(token.target_name, FileAccess::WRITE);
+	if (fa.is_null()) {
+		token.error = file->get_path() + " (FileWrite error)\n";
+		tasks_completed.increment();
+		return;
+	}
+
+	// hash while copying when verifying on extract, so the data is only read once
+	CryptoCore::MD5Context ctx;
+	if (token.check_md5) {
+		ctx.start();
+	}
+	int64_t rq_size = file->get_size();
+	// small files don't need the full buffer
+	Vector<uint8_t> buf;
+	buf.resize(CLAMP(rq_size, 1, MAX(opt_buffer_size, (int64_t)4096)));
+	uint8_t *w = buf.ptrw();
+	while (rq_size > 0) {
+		uint64_t got = pck_f->get_buffer(w, MIN(buf.size(), rq_size));
+		if (got == 0) {
+			break;
+		}
+		fa->store_buffer(w, got);
+		if (token.check_md5) {
+			ctx.update(w, got);
+		}
+		rq_size -= got;
+	}
+	fa->flush();
+	if (rq_size > 0) {
+		// the pack ended early, don't report the truncated file as extracted
+		token.error = file->get_path() + " (read error)\n";
+		tasks_completed.increment();
+		return;
+	}
+	token.extracted = true;
+	if (token.check_md5) {
+		unsigned char hash[16];
+		ctx.finish(hash);
+		token.md5_passed = memcmp(hash, file->pf.md5, 16) == 0;
+		if (!token.md5_passed) {
+			token.error = file->get_path() + " (MD5 mismatch)\n";
+		}
+	}
+	tasks_completed.increment();
+}
+
 Error PckDumper::_pck_dump_to_dir(
 		const String &dir,
 		const Vector<String> &files_to_extract,
@@ -94,53 +261,90 @@ Error PckDumper::_pck_dump_to_dir(
 			"Pack not loaded!");
 	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
 	auto files = GDRESettings::get_singleton()->get_file_info_list();
-	Vector<uint8_t> key = GDRESettings::get_singleton()->get_encryption_key();
 	uint64_t last_progress_upd = OS::get_singleton()->get_ticks_usec();
 
 	if (da.is_null()) {
 		return ERR_FILE_CANT_WRITE;
 	}
-	int files_extracted = 0;
-	Error err;
+
+	HashSet<String> extract_filter;
+	for (int i = 0; i < files_to_extract.size(); i++) {
+		extract_filter.insert(files_to_extract[i]);
+	}
+	Vector<ExtractToken> tokens;
+	HashSet<String> dirs;
 	for (int i = 0; i < files.size(); i++) {
-		if (files_to_extract.size() && !files_to_extract.has(files.get(i)->get_path())) {
+		if (files_to_extract.size() && !extract_filter.has(files[i]->get_path())) {
 			continue;
 		}
-		if (pr) {
-			if (OS::get_singleton()->get_ticks_usec() - last_progress_upd > 20000) {
-				last_progress_upd = OS::get_singleton()->get_ticks_usec();
-				bool cancel = pr->step(files.get(i)->get_path(), i, true);
-				if (cancel) {
-					return ERR_PRINTER_ON_FIRE;
+		ExtractToken token;
+		token.file = files[i];
+		token.target_name = dir.path_join(files[i]->get_path().replace("res://", ""));
+		token.check_md5 = should_check_md5 && !files[i]->is_encrypted() && files[i]->get_md5() != empty_md5;
+		dirs.insert(token.target_name.get_base_dir());
+		tokens.push_back(token);
+	}
+	tokens.sort_custom<ExtractTokenSort>();
+
+	// create each output directory once instead of once per file
+	for (const String &d : dirs) {
+		da->make_dir_recursive(d);
+	}
+
+	tasks_cancelled.clear();
+	tasks_completed.set(0);
+	int num_jobs = _get_num_jobs(tokens.size());
+	if (num_jobs <= 1) {
+		for (int i = 0; i < tokens.size(); i++) {
+			if (pr) {
+				if (OS::get_singleton()->get_ticks_usec() - last_progress_upd > 20000) {
+					last_progress_upd = OS::get_singleton()->get_ticks_usec();
+					bool cancel = pr->step(tokens[i].file->get_path(), i, true);
+					if (cancel) {
+						return ERR_PRINTER_ON_FIRE;
+					}
 				}
 			}
+			_do_extract(i, tokens.ptrw());
 		}
-		Ref<FileAccess> pck_f = FileAccess::open(files.get(i)->get_path(), FileAccess::READ, &err);
-		if (pck_f.is_null()) {
-			error_string += files.get(i)->get_path() + " (FileAccess error)\n";
-			continue;
+	} else {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(
+				this,
+				&PckDumper::_do_extract,
+				tokens.ptrw(),
+				tokens.size(), num_jobs, true, SNAME("PckDumper::pck_dump_to_dir"));
+		while (!WorkerThreadPool::get_singleton()->is_group_task_completed(group_task)) {
+			OS::get_singleton()->delay_usec(10000);
+			if (pr && !tasks_cancelled.is_set()) {
+				int completed = MIN((int)tasks_completed.get(), tokens.size() - 1);
+				if (pr->step(tokens[completed].file->get_path(), completed, true)) {
+					// files that have not been started yet will be skipped
+					tasks_cancelled.set();
+				}
+			}
 		}
-		String target_name = dir.path_join(files.get(i)->get_path().replace("res://", ""));
-		da->make_dir_recursive(target_name.get_base_dir());
-		Ref<FileAccess> fa = FileAccess::open(target_name, FileAccess::WRITE);
-		if (fa.is_null()) {
-			error_string += files.get(i)->get_path() + " (FileWrite error)\n";
-			continue;
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		if (tasks_cancelled.is_set()) {
+			return ERR_PRINTER_ON_FIRE;
 		}
+	}
 
-		int64_t rq_size = files.get(i)->get_size();
-		uint8_t buf[16384];
-		while (rq_size > 0) {
-			int got = pck_f->get_buffer(buf, MIN(16384, rq_size));
-			fa->store_buffer(buf, got);
-			rq_size -= 16384;
+	// report in extraction order so the output doesn't depend on the job count
+	int files_extracted = 0;
+	for (int i = 0; i < tokens.size(); i++) {
+		ExtractToken &token = tokens.write[i];
+		if (token.check_md5) {
+			token.file->set_md5_match(token.md5_passed);
+		}
+		error_string += token.error;
+		if (!token.extracted) {
+			continue;
 		}
-		fa->flush();
 		files_extracted++;
-		if (files.get(i)->is_malformed() && files.get(i)->get_raw_path() != files.get(i)->get_path()) {
-			print_line("Warning: " + files.get(i)->get_raw_path() + " is a malformed path!\nSaving to " + files.get(i)->get_path() + " instead.");
+		if (token.file->is_malformed() && token.file->get_raw_path() != token.file->get_path()) {
+			print_line("Warning: " + token.file->get_raw_path() + " is a malformed path!\nSaving to " + token.file->get_path() + " instead.");
 		}
-		print_verbose("Extracted " + target_name);
+		print_verbose("Extracted " + token.target_name);
 	}
 
 	if (error_string.length() > 0) {
@@ -155,6 +359,13 @@ Error PckDumper::_pck_dump_to_dir(
 
 void PckDumper::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("check_md5_all_files"), &PckDumper::check_md5_all_files);
+	ClassDB::bind_method(D_METHOD("get_broken_files"), &PckDumper::get_broken_files);
+	ClassDB::bind_method(D_METHOD("set_num_jobs", "num_jobs"), &PckDumper::set_num_jobs);
+	ClassDB::bind_method(D_METHOD("get_num_jobs"), &PckDumper::get_num_jobs);
+	ClassDB::bind_method(D_METHOD("set_check_md5_on_extract", "check"), &PckDumper::set_check_md5_on_extract);
+	ClassDB::bind_method(D_METHOD("get_check_md5_on_extract"), &PckDumper::get_check_md5_on_extract);
+	ClassDB::bind_method(D_METHOD("set_buffer_size", "size"), &PckDumper::set_buffer_size);
+	ClassDB::bind_method(D_METHOD("get_buffer_size"), &PckDumper::get_buffer_size);
 	ClassDB::bind_method(D_METHOD("pck_dump_to_dir", "dir", "files_to_extract"), &PckDumper::pck_dump_to_dir, DEFVAL(Vector<String>()));
 	//ClassDB::bind_method(D_METHOD("get_dumped_files"), &PckDumper::get_dumped_files);
 }
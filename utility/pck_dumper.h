@@ -8,6 +8,7 @@
 #include "core/object/object.h"
 #include "core/object/ref_counted.h"
 #include "core/templates/rb_map.h"
+#include "core/templates/safe_refcount.h"
 
 #include "editor/gdre_progress.h"
 
@@ -17,14 +18,52 @@ class PckDumper : public RefCounted {
 	bool skip_malformed_paths = false;
 	bool skip_failed_md5 = false;
 	bool should_check_md5 = false;
+	int opt_num_jobs = -1;
+	int64_t opt_buffer_size = 1024 * 1024;
+	Vector<String> last_broken_files;
+
+	struct MD5CheckToken {
+		Ref<PackedFileInfo> file;
+		bool passed = false;
+	};
+	struct ExtractToken {
+		Ref<PackedFileInfo> file;
+		String target_name;
+		String error;
+		bool check_md5 = false;
+		bool md5_passed = false;
+		bool extracted = false;
+	};
+	// extraction order: by pack, then by position in the pack for sequential reads
+	struct ExtractTokenSort {
+		bool operator()(const ExtractToken &a, const ExtractToken &b) const {
+			if (a.file->get_pack() != b.file->get_pack()) {
+				return a.file->get_pack() < b.file->get_pack();
+			}
+			return a.file->get_offset() < b.file->get_offset();
+		}
+	};
+	SafeFlag tasks_cancelled;
+	SafeNumeric<uint32_t> tasks_completed;
 
 	bool _pck_file_check_md5(Ref<PackedFileInfo> &file);
+	void _do_md5_check(uint32_t i, MD5CheckToken *tokens);
+	void _do_extract(uint32_t i, ExtractToken *tokens);
+	int _get_num_jobs(int p_num_items) const;
 
 protected:
 	static void _bind_methods();
 
 public:
+	void set_num_jobs(int p_num_jobs);
+	int get_num_jobs() const;
+	void set_check_md5_on_extract(bool p_check);
+	bool get_check_md5_on_extract() const;
+	void set_buffer_size(int64_t p_size);
+	int64_t get_buffer_size() const;
+
 	Error check_md5_all_files();
+	Vector<String> get_broken_files() const;
 	Error _check_md5_all_files(Vector<String> &broken_files, int &checked_files, EditorProgressGDDC *pr);
 
 	Error _pck_dump_to_dir(const String &dir, const Vector<String> &files_to_extract, EditorProgressGDDC *pr, String &error_string);
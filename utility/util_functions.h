@@ -43,15 +43,13 @@ static Vector<String> get_recursive_dir_list(const String dir, const Vector<Stri
 	return ret;
 }
 
-static Ref<FileAccess> _____tmp_file;
-
+// the webp packers convert a copy of the image themselves, so p_img is passed to them as is
 static Error save_image_as_webp(const String &p_path, const Ref<Image> &p_img, bool lossy = false) {
-	Ref<Image> source_image = p_img->duplicate();
 	Vector<uint8_t> buffer;
 	if (lossy) {
-		buffer = Image::webp_lossy_packer(source_image, 1);
+		buffer = Image::webp_lossy_packer(p_img, 1);
 	} else {
-		buffer = Image::webp_lossless_packer(source_image);
+		buffer = Image::webp_lossless_packer(p_img);
 	}
 	Error err;
 	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE, &err);
@@ -64,9 +62,63 @@ static Error save_image_as_webp(const String &p_path, const Ref<Image> &p_img, b
 	return OK;
 }
 
-static Error save_image_as_jpeg(const String &p_path, const Ref<Image> &p_img) {
+// TooJpeg hands us its output one byte at a time through a callback without any user data,
+// so the writer encoding on the current thread is looked up through a thread_local and bytes are
+// collected into a buffer that is written out in large chunks.
+class JPEGFileWriter {
+	static constexpr int BUFFER_SIZE = 65536;
+	Ref<FileAccess> file;
 	Vector<uint8_t> buffer;
-	Ref<Image> source_image = p_img->duplicate();
+	uint8_t *buffer_ptr = nullptr;
+	int buffer_pos = 0;
+
+	static JPEGFileWriter *&_get_current() {
+		thread_local JPEGFileWriter *current = nullptr;
+		return current;
+	}
+	static void _write_byte(unsigned char p_byte) {
+		JPEGFileWriter *writer = _get_current();
+		writer->buffer_ptr[writer->buffer_pos++] = p_byte;
+		if (writer->buffer_pos == BUFFER_SIZE) {
+			writer->_flush_buffer();
+		}
+	}
+	void _flush_buffer() {
+		file->store_buffer(buffer_ptr, buffer_pos);
+		buffer_pos = 0;
+	}
+
+public:
+	JPEGFileWriter(const Ref<FileAccess> &p_file) :
+			file(p_file) {
+		buffer.resize(BUFFER_SIZE);
+		buffer_ptr = buffer.ptrw();
+	}
+
+	// p_pixels are L8 or RGB8 (p_is_rgb)
+	Error write(const uint8_t *p_pixels, int p_width, int p_height, bool p_is_rgb, unsigned char p_quality = 100) {
+		JPEGFileWriter *&current = _get_current();
+		JPEGFileWriter *prev = current;
+		current = this;
+		bool success = TooJpeg::writeJpeg(&JPEGFileWriter::_write_byte, p_pixels, p_width, p_height, p_is_rgb, p_quality, false);
+		current = prev;
+		ERR_FAIL_COND_V_MSG(!success, ERR_BUG, "Failed to convert image to JPEG");
+		_flush_buffer();
+		if (file->get_error() != OK && file->get_error() != ERR_FILE_EOF) {
+			return ERR_CANT_CREATE;
+		}
+		file->flush();
+		return OK;
+	}
+};
+
+static Error save_image_as_jpeg(const String &p_path, const Ref<Image> &p_img) {
+	// L8 and RGB8 images can be encoded as they are, only copy the image if it has to be changed
+	Ref<Image> source_image = p_img;
+	Image::Format format = p_img->get_format();
+	if (p_img->is_compressed() || (format != Image::FORMAT_L8 && format != Image::FORMAT_RGB8)) {
+		source_image = p_img->duplicate();
+	}
 
 	if (source_image->is_compressed()) {
 		source_image->decompress();
@@ -99,31 +151,12 @@ static Error save_image_as_jpeg(const String &p_path, const Ref<Image> &p_img) {
 	}
 
 	const Vector<uint8_t> image_data = source_image->get_data();
-	// we may be passed a buffer with existing content we're expected to append to
 	Error err;
-	_____tmp_file = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE, &err);
 	ERR_FAIL_COND_V_MSG(err, err, vformat("Can't save JPEG at path: '%s'.", p_path));
 
-	bool success = false;
-	{ // scope writer lifetime
-		success = TooJpeg::writeJpeg([](unsigned char oneByte) {
-			_____tmp_file->store_8(oneByte);
-		},
-				image_data.ptr(), width, height, isRGB, 100, false);
-		if (!success) {
-			_____tmp_file = Ref<FileAccess>();
-		}
-		ERR_FAIL_COND_V_MSG(!success, ERR_BUG, "Failed to convert image to JPEG");
-	}
-
-	if (_____tmp_file->get_error() != OK && _____tmp_file->get_error() != ERR_FILE_EOF) {
-		_____tmp_file = Ref<FileAccess>();
-		;
-		return ERR_CANT_CREATE;
-	}
-	_____tmp_file->flush();
-	_____tmp_file = Ref<FileAccess>();
-	return OK;
+	JPEGFileWriter writer(file);
+	return writer.write(image_data.ptr(), width, height, isRGB);
 }
 
 } //namespace gdreutil